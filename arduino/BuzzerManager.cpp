@@ -4,13 +4,11 @@ BuzzerManager::BuzzerManager(int pin)
 {
     buzzerPin = pin;
     playing = false; // isPlaying -> playing으로 변경
-    startTime = 0;
     duration = 0;
     pauseDuration = 0;
     repeatCount = 0;
     currentRepeat = 0;
     isPaused = false;
-    pauseStartTime = 0;
 }
 
 void BuzzerManager::init()
@@ -27,7 +25,7 @@ void BuzzerManager::update(unsigned long currentMillis)
     if (isPaused)
     {
         // 일시정지 상태
-        if (currentMillis - pauseStartTime >= pauseDuration)
+        if (pauseTimer.hasElapsed(currentMillis, pauseDuration))
         {
             isPaused = false;
             currentRepeat++;
@@ -41,7 +39,7 @@ void BuzzerManager::update(unsigned long currentMillis)
             else
             {
                 // 다음 beep 시작
-                startTime = currentMillis;
+                beepTimer.start(currentMillis);
                 digitalWrite(buzzerPin, HIGH);
             }
         }
@@ -49,7 +47,7 @@ void BuzzerManager::update(unsigned long currentMillis)
     else
     {
         // beep 재생 상태
-        if (currentMillis - startTime >= duration)
+        if (beepTimer.hasElapsed(currentMillis, duration))
         {
             digitalWrite(buzzerPin, LOW);
 
@@ -62,7 +60,7 @@ void BuzzerManager::update(unsigned long currentMillis)
             {
                 // 일시정지 시작
                 isPaused = true;
-                pauseStartTime = currentMillis;
+                pauseTimer.start(currentMillis);
             }
         }
     }
@@ -79,7 +77,7 @@ void BuzzerManager::beep(int beepDuration)
 
     // 단일 beep 설정
     playing = true;
-    startTime = 0; // update에서 설정됨
+    beepTimer.start(millis());
     duration = beepDuration;
     pauseDuration = 0;
     repeatCount = 1;
@@ -100,7 +98,7 @@ void BuzzerManager::beepPattern(int count, int beepDuration, int interval)
 
     // 패턴 beep 설정
     playing = true;
-    startTime = 0; // update에서 설정됨
+    beepTimer.start(millis());
     duration = beepDuration;
     pauseDuration = interval;
     repeatCount = count;
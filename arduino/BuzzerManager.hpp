@@ -1,6 +1,7 @@
 #ifndef BUZZERMANAGER_HPP
 #define BUZZERMANAGER_HPP
 
+#include "Timer.hpp"
 #include <Arduino.h>
 
 class BuzzerManager
@@ -8,13 +9,13 @@ class BuzzerManager
 private:
     int buzzerPin;
     bool playing; // isPlaying -> playing으로 변경
-    unsigned long startTime;
+    Timer beepTimer;
     unsigned long duration;
     unsigned long pauseDuration;
     int repeatCount;
     int currentRepeat;
     bool isPaused;
-    unsigned long pauseStartTime;
+    Timer pauseTimer;
 
 public:
     BuzzerManager(int pin = 2);
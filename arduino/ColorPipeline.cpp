@@ -0,0 +1,85 @@
+#include "ColorPipeline.hpp"
+#include <avr/pgmspace.h>
+
+// round((i / 255) ^ LED_GAMMA * LED_BRIGHTNESS)
+static const uint8_t colorLut[256] PROGMEM = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+      2,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   4,   4,   4,   4,
+      4,   4,   4,   4,   4,   4,   5,   5,   5,   5,   5,   5,   5,   5,   6,   6,
+      6,   6,   6,   6,   6,   7,   7,   7,   7,   7,   7,   8,   8,   8,   8,   8,
+      8,   9,   9,   9,   9,   9,   9,  10,  10,  10,  10,  10,  11,  11,  11,  11,
+     11,  12,  12,  12,  12,  12,  13,  13,  13,  13,  13,  14,  14,  14,  14,  15,
+     15,  15,  15,  16,  16,  16,  16,  17,  17,  17,  17,  18,  18,  18,  19,  19,
+     19,  19,  20,  20,  20,  21,  21,  21,  21,  22,  22,  22,  23,  23,  23,  24,
+     24,  24,  25,  25,  25,  26,  26,  26,  27,  27,  27,  28,  28,  28,  29,  29,
+     29,  30,  30,  31,  31,  31,  32,  32,  32,  33,  33,  34,  34,  34,  35,  35,
+     36,  36,  37,  37,  37,  38,  38,  39,  39,  40,  40,  40,  41,  41,  42,  42,
+     43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  47,  48,  48,  49,  49,  50,
+};
+
+uint8_t ColorPipeline::correct(uint8_t value)
+{
+    return pgm_read_byte(&colorLut[value]);
+}
+
+uint32_t ColorPipeline::rgb(uint8_t r, uint8_t g, uint8_t b)
+{
+    return ((uint32_t)correct(r) << 16) | ((uint16_t)correct(g) << 8) | correct(b);
+}
+
+uint32_t ColorPipeline::hsv(uint16_t hue, uint8_t sat, uint8_t val)
+{
+    while (hue >= HUE_RANGE)
+    {
+        hue -= HUE_RANGE;
+    }
+
+    // 구간(0~5)과 구간 내 위치(0~255)
+    uint8_t sector = hue >> 8;
+    uint8_t rise = hue & 0xFF;
+    uint8_t fall = 255 - rise;
+    uint8_t r, g, b;
+
+    switch (sector)
+    {
+    case 0: // 빨강 -> 노랑
+        r = 255, g = rise, b = 0;
+        break;
+    case 1: // 노랑 -> 초록
+        r = fall, g = 255, b = 0;
+        break;
+    case 2: // 초록 -> 청록
+        r = 0, g = 255, b = rise;
+        break;
+    case 3: // 청록 -> 파랑
+        r = 0, g = fall, b = 255;
+        break;
+    case 4: // 파랑 -> 자홍
+        r = rise, g = 0, b = 255;
+        break;
+    default: // 자홍 -> 빨강
+        r = 255, g = 0, b = fall;
+        break;
+    }
+
+    // 채도: 흰색 쪽으로 끌어올림, 명도: 전체 스케일
+    if (sat != 255)
+    {
+        uint8_t white = 255 - sat;
+        r = white + ((r * (sat + 1)) >> 8);
+        g = white + ((g * (sat + 1)) >> 8);
+        b = white + ((b * (sat + 1)) >> 8);
+    }
+    if (val != 255)
+    {
+        r = (r * (val + 1)) >> 8;
+        g = (g * (val + 1)) >> 8;
+        b = (b * (val + 1)) >> 8;
+    }
+
+    return rgb(r, g, b);
+}
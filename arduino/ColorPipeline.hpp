@@ -0,0 +1,27 @@
+#ifndef COLORPIPELINE_HPP
+#define COLORPIPELINE_HPP
+
+#include <Arduino.h>
+
+// LED 색 변환
+// - 감마 보정과 밝기 스케일을 합친 256바이트 PROGMEM 테이블 (tools/gen_color_lut.py)
+// - 정수 연산만 쓰는 HSV -> RGB (색상 0 ~ HUE_RANGE-1)
+// Adafruit_NeoPixel::setBrightness 대신 이 테이블로 밝기를 적용
+#define LED_BRIGHTNESS 50 // 최대 출력값 (테이블 생성 시 값)
+#define LED_GAMMA 2.6
+
+class ColorPipeline
+{
+public:
+    static const uint16_t HUE_RANGE = 1536; // 6 구간 x 256
+
+    // 선형 8비트 RGB -> 보정된 출력 색 (uint32_t 0x00RRGGBB)
+    static uint32_t rgb(uint8_t r, uint8_t g, uint8_t b);
+
+    // 정수 HSV -> 보정된 출력 색, hue는 HUE_RANGE를 넘으면 감아서 사용
+    static uint32_t hsv(uint16_t hue, uint8_t sat = 255, uint8_t val = 255);
+
+    static uint8_t correct(uint8_t value);
+};
+
+#endif
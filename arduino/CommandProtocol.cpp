@@ -0,0 +1,128 @@
+#include "CommandProtocol.hpp"
+
+CommandProtocol::CommandProtocol()
+{
+    txHead = 0;
+    txTail = 0;
+    frameLength = 0;
+    frameOpcode = 0;
+    payloadIndex = 0;
+    state = WAIT_SYNC;
+    crc = 0;
+    malformedCount = 0;
+    overflowCount = 0;
+    skippedCount = 0;
+    txDroppedCount = 0;
+}
+
+void CommandProtocol::begin()
+{
+    transport.begin();
+}
+
+bool CommandProtocol::parseByte(uint8_t data)
+{
+    switch (state)
+    {
+    case WAIT_SYNC:
+        if (data == FRAME_SYNC)
+        {
+            state = WAIT_LENGTH;
+        }
+        else
+        {
+            skippedCount++;
+        }
+        break;
+
+    case WAIT_LENGTH:
+        if (data > Command::MAX_PAYLOAD)
+        {
+            overflowCount++;
+            state = WAIT_SYNC; // 잘못된 길이, 다음 동기 바이트부터 다시
+            break;
+        }
+        frameLength = data;
+        crc = crc8Update(0, data);
+        state = WAIT_OPCODE;
+        break;
+
+    case WAIT_OPCODE:
+        frameOpcode = data;
+        crc = crc8Update(crc, data);
+        payloadIndex = 0;
+        state = frameLength > 0 ? WAIT_PAYLOAD : WAIT_CRC;
+        break;
+
+    case WAIT_PAYLOAD:
+        frameBuffer[payloadIndex++] = data;
+        crc = crc8Update(crc, data);
+        if (payloadIndex >= frameLength)
+        {
+            state = WAIT_CRC;
+        }
+        break;
+
+    case WAIT_CRC:
+        state = WAIT_SYNC;
+        if (data != crc)
+        {
+            malformedCount++;
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+void CommandProtocol::queueByte(uint8_t data)
+{
+    txBuffer[txHead] = data;
+    txHead = (txHead + 1) & (TX_BUFFER_SIZE - 1);
+}
+
+void CommandProtocol::flushTx()
+{
+    // 드라이버 송신 버퍼에 들어갈 만큼만 넘김 (write가 블로킹되지 않음)
+    int room = transport.availableForWrite();
+    while (room > 0 && txTail != txHead)
+    {
+        transport.write(txBuffer[txTail]);
+        txTail = (txTail + 1) & (TX_BUFFER_SIZE - 1);
+        room--;
+    }
+}
+
+bool CommandProtocol::sendFrame(uint8_t opcode, const uint8_t *payload, uint8_t length)
+{
+    // 링 버퍼는 한 칸을 비워 두어 가득 참과 빔을 구분
+    uint8_t freeSpace = TX_BUFFER_SIZE - 1 - getTxPending();
+    if (length + 4 > freeSpace)
+    {
+        txDroppedCount++;
+        return false;
+    }
+
+    uint8_t frameCrc = crc8Update(0, length);
+    frameCrc = crc8Update(frameCrc, opcode);
+    frameCrc = crc8(payload, length, frameCrc);
+
+    queueByte(FRAME_SYNC);
+    queueByte(length);
+    queueByte(opcode);
+    for (uint8_t i = 0; i < length; i++)
+    {
+        queueByte(payload[i]);
+    }
+    queueByte(frameCrc);
+
+    // 바로 보낼 수 있는 만큼은 지금 보냄
+    flushTx();
+    return true;
+}
+
+bool CommandProtocol::sendAck(uint8_t opcode, uint8_t status)
+{
+    uint8_t payload[2] = {opcode, status};
+    return sendFrame(CMD_ACK, payload, sizeof(payload));
+}
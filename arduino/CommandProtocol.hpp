@@ -0,0 +1,130 @@
+#ifndef COMMANDPROTOCOL_HPP
+#define COMMANDPROTOCOL_HPP
+
+#include "CommandTransport.hpp"
+#include "Crc8.hpp"
+#include <Arduino.h>
+
+// 원격 제어 명령 (HC-05 블루투스 / USB 시리얼)
+// 프레임: [0xA5][길이][명령][데이터 x 길이][CRC8]
+// CRC8은 길이, 명령, 데이터에 대해 계산, 여러 바이트 값은 리틀 엔디언
+// HC-05는 COMMAND_BAUD와 같은 보드레이트로 설정해야 함 (AT+UART=115200,0,0)
+enum CommandOpcode
+{
+    CMD_PING = 0x00,           // 데이터 없음
+    CMD_SERVO_TARGET = 0x01,   // [서보 번호(1, 2, 0=둘 다)][각도]
+    CMD_MELODY = 0x02,         // [멜로디 번호] (0xFF = 정지)
+    CMD_LED_FRAME = 0x03,      // [시작 픽셀][R][G][B]...
+    CMD_LCD_TEXT = 0x04,       // [행][열][문자...]
+    CMD_TELEMETRY_RATE = 0x05, // [주기 (10ms 단위, 0 = 끔)]
+    CMD_STREAM_START = 0x06,   // 데이터 없음, 서보 궤적 스트림 시작
+    CMD_STREAM_POINTS = 0x07,  // [시간 하위][시간 상위][각도1][각도2] x 최대 5 (성공 시 ACK 없음)
+    CMD_STREAM_END = 0x08,     // [0 = 남은 설정점 재생 후 종료, 1 = 즉시 중단]
+    CMD_LOG_EXPORT = 0x09,     // 데이터 없음, 상호작용 기록 내보내기
+    CMD_DIAGNOSTICS = 0x0A,    // 데이터 없음: 메모리 진단 LCD 표시 (다음 터치까지) + 보고 1회, [주기 (초, 0 = 끔)]: 주기 보고
+    CMD_TELEMETRY = 0x10,      // 송신 전용: [순번][변경 비트마스크][값...]
+    CMD_STREAM_CREDIT = 0x11,  // 송신 전용: [소비한 수 (8비트 순환)][빈 칸][스트림 상태]
+    CMD_LOG_DATA = 0x12,       // 송신 전용: [번호 2바이트][기록 2바이트 x 최대 8], 끝: [전체 수][0xFF][경과 초 4바이트]
+    CMD_BOOT_REPORT = 0x13,    // 송신 전용: [입력 준비 ms 2바이트][LCD 준비 ms 2바이트]
+    CMD_MEMORY_REPORT = 0x14,  // 송신 전용: [정적][힙 최고][스택 최고][여유][미사용] 각 2바이트 (바이트 수)
+    CMD_ACK = 0x7F             // 응답: [명령][상태]
+};
+
+enum CommandStatus
+{
+    CMD_STATUS_OK = 0x00,
+    CMD_STATUS_BAD_ARGUMENT = 0x01,
+    CMD_STATUS_UNKNOWN = 0x02,
+    CMD_STATUS_BUSY = 0x03 // 버퍼 부족, 크레딧을 기다린 뒤 다시 보냄
+};
+
+// 수신 버퍼를 직접 가리키는 명령 (복사 없음, 핸들러 안에서만 유효)
+// payload[length]는 비어 있어 문자열 종료 문자를 써도 됨
+struct Command
+{
+    static const uint8_t MAX_PAYLOAD = 20;
+    uint8_t opcode;
+    uint8_t length;
+    uint8_t *payload;
+};
+
+class CommandProtocol
+{
+public:
+    static const uint8_t FRAME_SYNC = 0xA5;
+    static const uint8_t MAX_BYTES_PER_TICK = 16; // 틱당 최대 처리 바이트
+    static const uint8_t TX_BUFFER_SIZE = 32;     // 2의 거듭제곱
+
+private:
+    // 파서 상태
+    enum ParseState
+    {
+        WAIT_SYNC,
+        WAIT_LENGTH,
+        WAIT_OPCODE,
+        WAIT_PAYLOAD,
+        WAIT_CRC
+    };
+
+    CommandTransport transport;
+
+    // 송신 링 버퍼 (응답이 loop를 막지 않도록)
+    uint8_t txBuffer[TX_BUFFER_SIZE];
+    uint8_t txHead;
+    uint8_t txTail;
+
+    // 프레임 수신 버퍼 (데이터 + 종료 문자 1바이트)
+    uint8_t frameBuffer[Command::MAX_PAYLOAD + 1];
+    uint8_t frameLength;
+    uint8_t frameOpcode;
+    uint8_t payloadIndex;
+    uint8_t state;
+    uint8_t crc;
+
+    // 오류 카운터
+    uint16_t malformedCount; // CRC 불일치
+    uint16_t overflowCount;  // 버퍼보다 긴 프레임
+    uint16_t skippedCount;   // 동기 바이트를 찾으며 버린 바이트
+    uint16_t txDroppedCount; // 송신 버퍼가 모자라 버린 프레임
+
+    bool parseByte(uint8_t data);
+    void queueByte(uint8_t data);
+    void flushTx();
+
+public:
+    CommandProtocol();
+
+    void begin();
+
+    // 대기 중인 송신 바이트를 내보내고,
+    // 최대 MAX_BYTES_PER_TICK 바이트를 읽어 완성된 프레임마다 (target->*handler)(command) 호출
+    template <typename T>
+    void update(T *target, void (T::*handler)(const Command &command))
+    {
+        flushTx();
+
+        for (uint8_t budget = MAX_BYTES_PER_TICK; budget > 0 && transport.available() > 0; budget--)
+        {
+            if (parseByte(transport.read()))
+            {
+                Command command;
+                command.opcode = frameOpcode;
+                command.length = frameLength;
+                command.payload = frameBuffer;
+                (target->*handler)(command);
+            }
+        }
+    }
+
+    // 송신 버퍼에 프레임을 넣음 (공간이 없으면 false, 실제 전송은 update에서)
+    bool sendFrame(uint8_t opcode, const uint8_t *payload, uint8_t length);
+    bool sendAck(uint8_t opcode, uint8_t status);
+
+    uint16_t getMalformedCount() { return malformedCount; }
+    uint16_t getOverflowCount() { return overflowCount; }
+    uint16_t getSkippedCount() { return skippedCount; }
+    uint16_t getTxDroppedCount() { return txDroppedCount; }
+    uint8_t getTxPending() { return (uint8_t)(txHead - txTail) & (TX_BUFFER_SIZE - 1); }
+};
+
+#endif
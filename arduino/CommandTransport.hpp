@@ -0,0 +1,67 @@
+#ifndef COMMANDTRANSPORT_HPP
+#define COMMANDTRANSPORT_HPP
+
+#include <Arduino.h>
+
+// 명령 전송 계층 (컴파일 시점 선택, 가상 함수 없음)
+// 하드웨어 UART: D0/D1 (USB 시리얼과 공유, HC-05를 연결하면 업로드 시 분리 필요)
+//   Serial.print로 직접 쓰면 보내던 프레임 중간에 끼어들므로 모든 출력은 CommandProtocol 프레임으로
+// SoftwareSerial: 수신 바이트마다 인터럽트를 막으므로 서보/네오픽셀 타이밍이 흔들림
+#define COMMAND_TRANSPORT_HARDWARE 0
+#define COMMAND_TRANSPORT_SOFTWARE 1
+
+#ifndef COMMAND_TRANSPORT
+#define COMMAND_TRANSPORT COMMAND_TRANSPORT_HARDWARE
+#endif
+
+#ifndef COMMAND_BAUD
+#define COMMAND_BAUD 115200
+#endif
+
+// SoftwareSerial 핀 - 터치 센서(7, 8)와 겹치지 않게 빈 핀 사용
+#ifndef COMMAND_SOFT_RX_PIN
+#define COMMAND_SOFT_RX_PIN 5 // BT의 TXD 연결
+#endif
+#ifndef COMMAND_SOFT_TX_PIN
+#define COMMAND_SOFT_TX_PIN 6 // BT의 RXD 연결
+#endif
+#ifndef COMMAND_SOFT_BAUD
+#define COMMAND_SOFT_BAUD 9600 // HC-05 기본값
+#endif
+
+// 하드웨어 UART - 전역 Serial 객체를 직접 호출 (컴파일러가 가상 호출을 풀어냄)
+class HardwareUartTransport
+{
+public:
+    void begin() { Serial.begin(COMMAND_BAUD); }
+    int available() { return Serial.available(); }
+    int read() { return Serial.read(); }
+    int availableForWrite() { return Serial.availableForWrite(); }
+    void write(uint8_t data) { Serial.write(data); }
+};
+
+#if COMMAND_TRANSPORT == COMMAND_TRANSPORT_SOFTWARE
+#include <SoftwareSerial.h>
+
+class SoftwareSerialTransport
+{
+private:
+    SoftwareSerial port;
+
+public:
+    SoftwareSerialTransport() : port(COMMAND_SOFT_RX_PIN, COMMAND_SOFT_TX_PIN) {}
+
+    void begin() { port.begin(COMMAND_SOFT_BAUD); }
+    int available() { return port.available(); }
+    int read() { return port.read(); }
+    // 송신은 바이트마다 블로킹되므로 틱당 1바이트만 보냄
+    int availableForWrite() { return 1; }
+    void write(uint8_t data) { port.write(data); }
+};
+
+typedef SoftwareSerialTransport CommandTransport;
+#else
+typedef HardwareUartTransport CommandTransport;
+#endif
+
+#endif
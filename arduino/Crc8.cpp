@@ -0,0 +1,20 @@
+#include "Crc8.hpp"
+
+uint8_t crc8Update(uint8_t crc, uint8_t data)
+{
+    crc ^= data;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : (crc << 1);
+    }
+    return crc;
+}
+
+uint8_t crc8(const uint8_t *data, uint8_t length, uint8_t crc)
+{
+    for (uint8_t i = 0; i < length; i++)
+    {
+        crc = crc8Update(crc, data[i]);
+    }
+    return crc;
+}
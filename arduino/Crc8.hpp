@@ -0,0 +1,10 @@
+#ifndef CRC8_HPP
+#define CRC8_HPP
+
+#include <Arduino.h>
+
+// CRC-8 (다항식 0x07, 초기값 0x00)
+uint8_t crc8Update(uint8_t crc, uint8_t data);
+uint8_t crc8(const uint8_t *data, uint8_t length, uint8_t crc = 0);
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef DEADLINE_HPP
+#define DEADLINE_HPP
+
+#include <Arduino.h>
+
+// 정해진 시각이 지났는지 (millis() 순환에 안전)
+// 부호 있는 차이로 비교하므로 남은 시간이 2^31ms(약 24.8일) 미만이면 순환을 넘어도 맞음
+class Deadline
+{
+private:
+    uint32_t dueTime;
+
+public:
+    Deadline() : dueTime(0) {}
+
+    void set(unsigned long currentMillis, uint32_t delayMs) { dueTime = (uint32_t)currentMillis + delayMs; }
+    bool hasPassed(unsigned long currentMillis) const { return remaining(currentMillis) <= 0; }
+    int32_t remaining(unsigned long currentMillis) const { return (int32_t)(dueTime - (uint32_t)currentMillis); }
+};
+
+#endif
@@ -1,90 +1,91 @@
 #include "DisplayManager.hpp"
 
-DisplayManager::DisplayManager(int neoPin, int neoCount)
+DisplayManager::DisplayManager(int neoPin, int neoCount, EventBus *bus, uint16_t missionsPerTier)
+    : strip(neoCount, neoPin, NEO_GRB + NEO_KHZ800), lcd(0x27, 16, 2), animator(&strip),
+      missionRenderer(neoCount, missionsPerTier)
 {
+    eventBus = bus;
     neoPixelPin = neoPin;
     neoPixelCount = neoCount;
     lcdBacklight = true;
+    pixelsDirty = false;
+    showCount = 0;
+    commitDeferred = false;
+    deferredCount = 0;
 
     // LCD 최적화 변수 초기화
-    lastServo1Angle = -1;
-    lastServo2Angle = -1;
     lastTouch1Display = false;
     lastTouch2Display = false;
+#if SONEEBOT_STATUS_DISPLAY
+    lastServo1Angle = -1;
+    lastServo2Angle = -1;
     lastTouch3Display = false;
     lastTouch1DurationDisplay = 0;
     lastTouch2DurationDisplay = 0;
     lastTouch3DurationDisplay = 0;
+#endif
     lastMissionCountDisplay = -1;
+    lastMissionIdDisplay = 0;
 
     // 미션 완료 효과 변수 초기화
     missionCompleted = false;
-    missionCompleteTime = 0;
     showingGoodJob = false;
-    goodJobStartTime = 0;
-
-    // 객체 생성
-    strip = new Adafruit_NeoPixel(neoPixelCount, neoPixelPin, NEO_GRB + NEO_KHZ800);
-    lcd = new LiquidCrystal_I2C(0x27, 16, 2);
-}
-
-DisplayManager::~DisplayManager()
-{
-    delete strip;
-    delete lcd;
 }
 
 void DisplayManager::init()
 {
     // 네오픽셀 초기화
-    strip->begin();
-    strip->setBrightness(50);
-    strip->show();
+    strip.begin();
+    strip.show(); // 밝기는 ColorPipeline 테이블에서 적용
 
-    // LCD 초기화
-    lcd->init();
-    lcd->backlight();
+    // 초기화 효과 (update에서 진행)
+    rainbowEffect();
+}
+
+void DisplayManager::initLcd()
+{
+    // LCD 초기화 (라이브러리 내부 대기 약 70ms)
+    lcd.init();
+    lcd.backlight();
 
     // 초기화 메시지
     lcdClear();
     lcdPrint(0, 0, "SoneeBot Ready!");
     lcdPrint(0, 1, "Initializing...");
-
-    // 초기화 효과
-    rainbowEffect();
 }
 
 void DisplayManager::lcdPrint(int col, int row, String text)
 {
-    lcd->setCursor(col, row);
-    lcd->print(text);
+    lcd.setCursor(col, row);
+    lcd.print(text);
 }
 
 void DisplayManager::lcdClear()
 {
-    lcd->clear();
+    lcd.clear();
 }
 
 void DisplayManager::lcdBacklightOn()
 {
-    lcd->backlight();
+    lcd.backlight();
     lcdBacklight = true;
 }
 
 void DisplayManager::lcdBacklightOff()
 {
-    lcd->noBacklight();
+    lcd.noBacklight();
     lcdBacklight = false;
 }
 
 void DisplayManager::showGoodJobMessage(unsigned long currentMillis)
 {
     showingGoodJob = true;
-    goodJobStartTime = currentMillis;
+    goodJobTimer.start(currentMillis);
     lcdClear();
     lcdPrint(0, 0, "Good Job !!");
 }
 
+#if SONEEBOT_STATUS_DISPLAY
 void DisplayManager::updateStatusDisplay(int servo1Angle, int servo2Angle, bool touch1, bool touch2, bool touch3,
                                          unsigned long touch1Duration, unsigned long touch2Duration, unsigned long touch3Duration)
 {
@@ -146,23 +147,33 @@ void DisplayManager::updateStatusDisplay(int servo1Angle, int servo2Angle, bool
         lastTouch3DurationDisplay = currentTouch3Sec;
     }
 }
+#endif
+
+void DisplayManager::writePixel(int pixel, uint32_t color)
+{
+    if (LedAnimator::writePixel(&strip, pixel, color))
+    {
+        pixelsDirty = true;
+    }
+}
 
 void DisplayManager::setPixelColor(int pixel, uint8_t r, uint8_t g, uint8_t b)
 {
     if (pixel >= 0 && pixel < neoPixelCount)
     {
-        strip->setPixelColor(pixel, strip->Color(r, g, b));
-        strip->show();
+        writePixel(pixel, ColorPipeline::rgb(r, g, b));
+        missionRenderer.invalidate();
     }
 }
 
 void DisplayManager::fillColor(uint8_t r, uint8_t g, uint8_t b)
 {
+    uint32_t color = ColorPipeline::rgb(r, g, b);
     for (int i = 0; i < neoPixelCount; i++)
     {
-        strip->setPixelColor(i, strip->Color(r, g, b));
+        writePixel(i, color);
     }
-    strip->show();
+    missionRenderer.invalidate();
 }
 
 void DisplayManager::clearPixels()
@@ -172,73 +183,78 @@ void DisplayManager::clearPixels()
 
 void DisplayManager::rainbowEffect()
 {
-    for (int j = 0; j < 256; j += 5)
-    {
-        for (int i = 0; i < neoPixelCount; i++)
-        {
-            strip->setPixelColor(i, strip->ColorHSV((i * 65536L / neoPixelCount) + j * 256));
-        }
-        strip->show();
-        delay(10);
-    }
+    animator.start(LED_EFFECT_RAINBOW);
 }
 
 void DisplayManager::updateMissionPixels(int missionCount)
 {
-    clearPixels();
-
-    if (missionCount <= 0)
-        return;
-
-    for (int i = 0; i < min(missionCount, 12); i++)
+    // 초기화 무지개가 아직 돌고 있으면 미션 표시가 우선
+    if (animator.getEffect() == LED_EFFECT_RAINBOW)
     {
-        int pixelIndex = i % 4;
+        animator.stop();
+    }
 
-        if (i < 4)
-        {
-            strip->setPixelColor(pixelIndex, strip->Color(0, 255, 0));
-        }
-        else if (i < 8)
-        {
-            strip->setPixelColor(pixelIndex, strip->Color(0, 0, 255));
-        }
-        else
+    // 바뀐 픽셀 범위만 최종 색으로 한 번씩 기록 (지웠다가 다시 그리지 않음)
+    uint16_t firstPixel, lastPixel;
+    if (missionRenderer.update(missionCount, firstPixel, lastPixel))
+    {
+        for (uint16_t i = firstPixel; i <= lastPixel; i++)
         {
-            strip->setPixelColor(pixelIndex, strip->Color(255, 0, 0));
+            writePixel(i, missionRenderer.colorAt(i));
         }
     }
+}
 
-    strip->show();
+void DisplayManager::commit()
+{
+    if (!pixelsDirty)
+        return;
+
+    strip.show();
+    pixelsDirty = false;
+    commitDeferred = false;
+    showCount++;
 }
 
-void DisplayManager::missionCompleteEffect(unsigned long currentMillis)
+void DisplayManager::commit(unsigned long currentMillis, bool servoWindowIdle, bool toneSounding)
 {
-    unsigned long elapsed = currentMillis - missionCompleteTime;
+    if (!pixelsDirty)
+        return;
 
-    if (elapsed < 3000)
+    // 서보 펄스 구간은 20ms 프레임마다 금방 지나가므로 항상 기다림
+    if (!servoWindowIdle)
     {
-        int hue = (elapsed / 10) % 360;
-        for (int i = 0; i < neoPixelCount; i++)
-        {
-            int pixelHue = (hue + i * 90) % 360;
-            strip->setPixelColor(i, strip->ColorHSV(pixelHue * 182));
-        }
-        strip->show();
+        deferredCount++;
+        return;
     }
-    else
+
+    if (toneSounding)
     {
-        missionCompleted = false;
-        clearPixels();
+        if (!commitDeferred)
+        {
+            commitDeferred = true;
+            deferTimer.start(currentMillis);
+        }
+
+        // 긴 음에서 LED가 멈춰 보이지 않도록 일정 시간 후에는 출력
+        if (!deferTimer.hasElapsed(currentMillis, MAX_DEFER_MS))
+        {
+            deferredCount++;
+            return;
+        }
     }
+
+    commit();
 }
 
-void DisplayManager::updateMissionDisplay(int missionCount, bool touch1State, bool touch2State)
+void DisplayManager::updateMissionDisplay(uint8_t missionId, int missionCount, bool touch1State, bool touch2State)
 {
-    if (missionCount != lastMissionCountDisplay || touch1State != lastTouch1Display || touch2State != lastTouch2Display)
+    if (missionId != lastMissionIdDisplay || missionCount != lastMissionCountDisplay ||
+        touch1State != lastTouch1Display || touch2State != lastTouch2Display)
     {
         updateMissionPixels(missionCount);
         lcdClear();
-        lcdPrint(0, 0, "Today Mission!!");
+        lcdPrint(0, 0, "Today Mission " + String(missionId + 1));
 
         String missionInfo = ": " + String(missionCount);
         lcdPrint(0, 1, missionInfo);
@@ -256,6 +272,7 @@ void DisplayManager::updateMissionDisplay(int missionCount, bool touch1State, bo
             lcdPrint(4, 1, " (Done)");
         }
 
+        lastMissionIdDisplay = missionId;
         lastMissionCountDisplay = missionCount;
         lastTouch1Display = touch1State;
         lastTouch2Display = touch2State;
@@ -265,7 +282,7 @@ void DisplayManager::updateMissionDisplay(int missionCount, bool touch1State, bo
 void DisplayManager::startMissionCompleteEffect(unsigned long currentMillis)
 {
     missionCompleted = true;
-    missionCompleteTime = currentMillis;
+    animator.start(LED_EFFECT_CELEBRATION);
 
     lcdClear();
     lcdPrint(0, 0, "MISSION");
@@ -276,16 +293,34 @@ void DisplayManager::update(unsigned long currentMillis)
 {
     if (showingGoodJob)
     {
-        unsigned long elapsed = currentMillis - goodJobStartTime;
-        if (elapsed >= 1000)
+        if (goodJobTimer.hasElapsed(currentMillis, 1000))
         {
             showingGoodJob = false;
+
+            if (eventBus)
+            {
+                eventBus->post(EVENT_ANIMATION_FINISHED, ANIMATION_GOOD_JOB);
+            }
         }
     }
 
-    if (missionCompleted)
+    uint8_t ledResult = animator.update(currentMillis);
+    if (ledResult & LED_FRAME_CHANGED)
+    {
+        pixelsDirty = true;
+        missionRenderer.invalidate();
+    }
+
+    // 효과가 끝난 틱에만 처리
+    if ((ledResult & LED_EFFECT_DONE) && missionCompleted)
     {
-        missionCompleteEffect(currentMillis);
+        missionCompleted = false;
+        clearPixels();
+
+        if (eventBus)
+        {
+            eventBus->post(EVENT_ANIMATION_FINISHED, ANIMATION_MISSION_COMPLETE);
+        }
     }
 }
 
@@ -1,6 +1,11 @@
 #ifndef DISPLAYMANAGER_HPP
 #define DISPLAYMANAGER_HPP
 
+#include "EventBus.hpp"
+#include "LedAnimator.hpp"
+#include "MissionRenderer.hpp"
+#include "SoneeBotConfig.hpp"
+#include "Timer.hpp"
 #include <Adafruit_NeoPixel.h>
 #include <Arduino.h>
 #include <LiquidCrystal_I2C.h>
@@ -8,41 +13,60 @@
 class DisplayManager
 {
 private:
-    Adafruit_NeoPixel *strip;
-    LiquidCrystal_I2C *lcd;
+    Adafruit_NeoPixel strip;
+    LiquidCrystal_I2C lcd;
+    LedAnimator animator;
+    MissionRenderer missionRenderer;
+    EventBus *eventBus;
     int neoPixelPin;
     int neoPixelCount;
     bool lcdBacklight;
 
+    // 픽셀 버퍼 변경 여부 (show는 commit에서 틱당 최대 1회)
+    bool pixelsDirty;
+    unsigned long showCount; // 실제 show() 횟수 (시뮬레이터 leds 명령으로 확인)
+
+    // 안전 구간을 기다리며 출력을 미룬 상태
+    bool commitDeferred;
+    Timer deferTimer;
+    unsigned long deferredCount;
+
+    void writePixel(int pixel, uint32_t color);
+
     // LCD 최적화 변수들
-    int lastServo1Angle;
-    int lastServo2Angle;
     bool lastTouch1Display;
     bool lastTouch2Display;
+    int lastMissionCountDisplay;
+    uint8_t lastMissionIdDisplay;
+#if SONEEBOT_STATUS_DISPLAY
+    int lastServo1Angle;
+    int lastServo2Angle;
     bool lastTouch3Display;
     unsigned long lastTouch1DurationDisplay;
     unsigned long lastTouch2DurationDisplay;
     unsigned long lastTouch3DurationDisplay;
-    int lastMissionCountDisplay;
+#endif
 
     // 미션 완료 효과 변수들
     bool missionCompleted;
-    unsigned long missionCompleteTime;
     bool showingGoodJob;
-    unsigned long goodJobStartTime;
+    Timer goodJobTimer;
 
 public:
-    DisplayManager(int neoPin = 3, int neoCount = 4);
-    ~DisplayManager();
+    // missionsPerTier: 스트립 전체를 한 색 단계로 채우는 미션 수 (0이면 픽셀당 미션 하나)
+    DisplayManager(int neoPin = 3, int neoCount = 4, EventBus *bus = 0, uint16_t missionsPerTier = 0);
     void init();
+    void initLcd(); // 첫 틱에 호출 (블로킹 구간을 setup 밖으로)
 
     // LCD 제어
     void lcdPrint(int col, int row, String text);
     void lcdClear();
     void lcdBacklightOn();
     void lcdBacklightOff();
+#if SONEEBOT_STATUS_DISPLAY
     void updateStatusDisplay(int servo1Angle, int servo2Angle, bool touch1, bool touch2, bool touch3,
                              unsigned long touch1Duration, unsigned long touch2Duration, unsigned long touch3Duration);
+#endif
 
     // 네오픽셀 제어
     void setPixelColor(int pixel, uint8_t r, uint8_t g, uint8_t b);
@@ -50,13 +74,21 @@ public:
     void clearPixels();
     void rainbowEffect();
     void updateMissionPixels(int missionCount);
-    void missionCompleteEffect(unsigned long currentMillis);
+    void commit();
+    // 서보 펄스 구간이면 항상 미루고, 부저 음 출력 중이면 최대 MAX_DEFER_MS까지 미룸
+    void commit(unsigned long currentMillis, bool servoWindowIdle, bool toneSounding);
+    uint16_t getShowDurationUs() { return neoPixelCount * 30 + 10; } // show() 중 인터럽트 차단 시간
+    unsigned long getDeferredCount() { return deferredCount; }
+    static const uint8_t MAX_DEFER_MS = 100;
+    unsigned long getShowCount() { return showCount; }
 
     // 미션 관련 디스플레이
-    void updateMissionDisplay(int missionCount, bool touch1State, bool touch2State);
+    void invalidateMissionDisplay() { lastMissionCountDisplay = -1; } // 다음 updateMissionDisplay에서 다시 그림
+    void updateMissionDisplay(uint8_t missionId, int missionCount, bool touch1State, bool touch2State);
     void startMissionCompleteEffect(unsigned long currentMillis);
     void update(unsigned long currentMillis);
     bool isMissionCompleteEffectRunning();
+    bool isBootEffectRunning() { return animator.getEffect() == LED_EFFECT_RAINBOW; }
     bool isShowingGoodJob();
     void showGoodJobMessage(unsigned long currentMillis);
 };
@@ -0,0 +1,53 @@
+#include "EepromWriter.hpp"
+
+EepromWriter::EepromWriter()
+{
+    source = 0;
+    address = 0;
+    remaining = 0;
+    byteWriteCount = 0;
+}
+
+bool EepromWriter::start(uint16_t address, const uint8_t *data, uint8_t length)
+{
+    if (remaining > 0)
+    {
+        return false;
+    }
+
+    source = data;
+    this->address = address;
+    remaining = length;
+    return true;
+}
+
+void EepromWriter::update()
+{
+    // 같은 값이면 바로 다음 바이트로, 실제 쓰기는 틱당 한 번
+    while (remaining > 0 && eeprom_is_ready())
+    {
+        bool changed = EEPROM.read(address) != *source;
+        if (changed)
+        {
+            EEPROM.write(address, *source);
+            byteWriteCount++;
+        }
+
+        source++;
+        address++;
+        remaining--;
+
+        if (changed)
+        {
+            break;
+        }
+    }
+}
+
+void EepromWriter::flush()
+{
+    while (remaining > 0)
+    {
+        update();
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef EEPROMWRITER_HPP
+#define EEPROMWRITER_HPP
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <avr/eeprom.h>
+
+// 비블로킹 EEPROM 쓰기
+// EEPROM 바이트 쓰기는 약 3.3ms 걸리므로, 이전 쓰기가 끝났을 때만 틱당 1바이트씩 씀
+// 같은 값인 바이트는 건너뜀 (EEPROM.update, 쓰기 횟수 절약)
+class EepromWriter
+{
+private:
+    const uint8_t *source; // 작업이 끝날 때까지 호출자가 유지해야 함
+    uint16_t address;
+    uint8_t remaining;
+    uint16_t byteWriteCount;
+
+public:
+    EepromWriter();
+
+    // 쓰기 작업 시작, 이전 작업이 진행 중이면 false
+    bool start(uint16_t address, const uint8_t *data, uint8_t length);
+    void update();
+    // 남은 바이트를 기다리며 모두 씀 (절전 진입 전 등)
+    void flush();
+
+    bool isBusy() { return remaining > 0; }
+    uint16_t getByteWriteCount() { return byteWriteCount; }
+};
+
+#endif
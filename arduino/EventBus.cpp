@@ -0,0 +1,37 @@
+#include "EventBus.hpp"
+
+EventBus::EventBus()
+{
+    queueStart = 0;
+    queueSize = 0;
+    droppedCount = 0;
+}
+
+bool EventBus::post(uint8_t type, uint8_t arg0, uint8_t arg1, int16_t value)
+{
+    if (queueSize >= MAX_EVENTS)
+    {
+        if (droppedCount < 255)
+            droppedCount++;
+        return false; // 큐가 가득 참
+    }
+
+    Event &event = eventQueue[(queueStart + queueSize) % MAX_EVENTS];
+    event.type = type;
+    event.arg0 = arg0;
+    event.arg1 = arg1;
+    event.value = value;
+    queueSize++;
+    return true;
+}
+
+bool EventBus::poll(Event &event)
+{
+    if (queueSize == 0)
+        return false;
+
+    event = eventQueue[queueStart];
+    queueStart = (queueStart + 1) % MAX_EVENTS;
+    queueSize--;
+    return true;
+}
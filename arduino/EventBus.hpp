@@ -0,0 +1,79 @@
+#ifndef EVENTBUS_HPP
+#define EVENTBUS_HPP
+
+#include <Arduino.h>
+
+// 이벤트 종류
+enum EventType
+{
+    EVENT_TOUCH,              // arg0: GestureType, arg1: 센서 번호, value: 제스처 값
+    EVENT_MISSION_CHANGED,    // arg0: 미션 번호, arg1: MissionChange, value: 남은 횟수
+    EVENT_ANIMATION_FINISHED, // arg0: AnimationSource
+    EVENT_MISSION_COMPLETED,  // arg0: 미션 번호
+    EVENT_TYPE_COUNT
+};
+
+// 애니메이션 종료 이벤트의 출처
+enum AnimationSource
+{
+    ANIMATION_SERVO,
+    ANIMATION_GOOD_JOB,
+    ANIMATION_MISSION_COMPLETE
+};
+
+struct Event
+{
+    uint8_t type;
+    uint8_t arg0;
+    uint8_t arg1;
+    int16_t value;
+};
+
+// 이벤트 타입 -> 핸들러 멤버 함수 (정적 디스패치 테이블의 한 줄)
+template <typename T>
+struct EventRoute
+{
+    uint8_t type;
+    void (T::*handler)(const Event &event);
+};
+
+// 고정 크기 이벤트 큐 (동적 할당 없음)
+class EventBus
+{
+private:
+    static const uint8_t MAX_EVENTS = 16;
+    Event eventQueue[MAX_EVENTS];
+    uint8_t queueStart;
+    uint8_t queueSize;
+    uint8_t droppedCount;
+
+public:
+    EventBus();
+
+    // 큐가 가득 차면 false (이벤트 버림)
+    bool post(uint8_t type, uint8_t arg0 = 0, uint8_t arg1 = 0, int16_t value = 0);
+    bool poll(Event &event);
+
+    // 큐가 빌 때까지 이벤트를 꺼내 테이블에 등록된 핸들러 호출
+    // 핸들러가 새로 post한 이벤트도 같은 호출 안에서 처리됨
+    template <typename T>
+    void dispatch(T *target, const EventRoute<T> *routes, uint8_t routeCount)
+    {
+        Event event;
+        while (poll(event))
+        {
+            for (uint8_t i = 0; i < routeCount; i++)
+            {
+                if (routes[i].type == event.type)
+                {
+                    (target->*routes[i].handler)(event);
+                }
+            }
+        }
+    }
+
+    uint8_t getQueueSize() { return queueSize; }
+    uint8_t getDroppedCount() { return droppedCount; }
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef FASTPIN_HPP
+#define FASTPIN_HPP
+
+#include <Arduino.h>
+
+// 우노 핀 배치: D0~D7 = PORTD, D8~D13 = PORTB, A0~A5(14~19) = PORTC
+// PortSnapshot 안의 위치 (0 = B, 1 = C, 2 = D)와 비트 마스크
+constexpr uint8_t fastPinPort(uint8_t pin) { return pin < 8 ? 2 : (pin < 14 ? 0 : 1); }
+constexpr uint8_t fastPinMask(uint8_t pin) { return 1 << (pin < 8 ? pin : (pin < 14 ? pin - 8 : pin - 14)); }
+
+// 컴파일 시점 핀 번호로 포트 레지스터 직접 접근
+// - 우노(ATmega328P)에서 read/high/low는 sbic/sbi/cbi 명령 하나로 컴파일됨
+// - digitalRead/digitalWrite의 핀 표 조회, PWM 타이머 해제 검사가 없으므로
+//   PWM(analogWrite)을 쓰는 핀에는 사용하지 말 것
+// - 다른 보드나 호스트 시뮬레이터에서는 digitalRead/digitalWrite로 대체
+template <uint8_t PIN> class FastPin
+{
+public:
+    static_assert(PIN < 20, "Uno pin numbers are 0-19");
+
+    static const uint8_t MASK = fastPinMask(PIN);
+
+#if defined(__AVR_ATmega328P__)
+    static bool read() { return (PIN < 8 ? PIND : (PIN < 14 ? PINB : PINC)) & MASK; }
+
+    static void high()
+    {
+        if (PIN < 8)
+            PORTD |= MASK;
+        else if (PIN < 14)
+            PORTB |= MASK;
+        else
+            PORTC |= MASK;
+    }
+
+    static void low()
+    {
+        if (PIN < 8)
+            PORTD &= ~MASK;
+        else if (PIN < 14)
+            PORTB &= ~MASK;
+        else
+            PORTC &= ~MASK;
+    }
+#else
+    static bool read() { return digitalRead(PIN) == HIGH; }
+    static void high() { digitalWrite(PIN, HIGH); }
+    static void low() { digitalWrite(PIN, LOW); }
+#endif
+
+    static void write(bool value)
+    {
+        if (value)
+            high();
+        else
+            low();
+    }
+};
+
+// 포트 입력 레지스터 3개를 한 번에 읽어 둔 값
+// 여러 핀을 같은 시점으로 보려면 핀마다 읽지 말고 스냅샷 하나에서 비트 검사
+struct PortSnapshot
+{
+    uint8_t ports[3]; // PINB, PINC, PIND
+
+    void read()
+    {
+#if defined(__AVR_ATmega328P__)
+        ports[0] = PINB;
+        ports[1] = PINC;
+        ports[2] = PIND;
+#else
+        // 우노와 같은 핀 배치를 흉내내는 호스트 시뮬레이터용
+        ports[0] = *portInputRegister(digitalPinToPort(8));
+        ports[1] = *portInputRegister(digitalPinToPort(14));
+        ports[2] = *portInputRegister(digitalPinToPort(0));
+#endif
+    }
+
+    bool isHigh(uint8_t pin) const { return ports[fastPinPort(pin)] & fastPinMask(pin); }
+};
+
+#endif
@@ -0,0 +1,115 @@
+#include "GestureRecognizer.hpp"
+
+GestureRecognizer::GestureRecognizer(EventBus *bus, const GestureConfig *configTable,
+                                     const uint8_t *chordTable, uint8_t chordTableSize)
+{
+    eventBus = bus;
+    configs = configTable;
+    chords = chordTable;
+    chordCount = chordTableSize;
+    longPressMask = 0;
+    tapArmedMask = 0;
+
+    for (uint8_t i = 0; i < TouchBank::MAX_SENSORS; i++)
+    {
+        repeatCounts[i] = 0;
+    }
+}
+
+void GestureRecognizer::update(TouchBank *bank, unsigned long currentMillis)
+{
+    uint8_t held = bank->getHeldMask();
+    uint8_t released = bank->getReleasedMask();
+
+    // 아무도 터치하지 않은 틱은 비트마스크 검사만 하고 종료
+    uint8_t active = held | released;
+    if (!active)
+        return;
+
+    for (uint8_t i = 0; i < bank->getSensorCount(); i++)
+    {
+        if (active & (1 << i))
+        {
+            updateSensor(bank, i, currentMillis);
+        }
+    }
+
+    // 새로 눌린 센서가 있을 때만 조합 테이블 검사
+    uint8_t pressed = bank->getPressedMask();
+    if (pressed && (held & (held - 1)))
+    {
+        for (uint8_t c = 0; c < chordCount; c++)
+        {
+            uint8_t mask = chords[c];
+            if ((held & mask) == mask && (pressed & mask))
+            {
+                push(GESTURE_CHORD, 0, mask);
+            }
+        }
+    }
+}
+
+void GestureRecognizer::updateSensor(TouchBank *bank, uint8_t id, unsigned long currentMillis)
+{
+    const GestureConfig &config = configs[id];
+    uint8_t bit = 1 << id;
+
+    if (bank->isPressed(id))
+    {
+        repeatCounts[id] = 0;
+        longPressMask &= ~bit;
+        push(GESTURE_PRESS, id);
+    }
+
+    if (bank->isHeld(id))
+    {
+        unsigned long duration = bank->getDuration(id);
+
+        // 터치 시작 즉시 1회, 이후 repeatMs 마다 1회
+        if (config.repeatMs > 0)
+        {
+            unsigned long expectedCount = (duration / config.repeatMs) + 1;
+            if (expectedCount > repeatCounts[id] && repeatCounts[id] < 255)
+            {
+                push(GESTURE_REPEAT, id, repeatCounts[id]);
+                repeatCounts[id]++;
+            }
+        }
+
+        if (config.longPressMs > 0 && !(longPressMask & bit) && duration >= config.longPressMs)
+        {
+            longPressMask |= bit;
+            push(GESTURE_LONG_PRESS, id);
+        }
+        return;
+    }
+
+    // 해제
+    push(GESTURE_RELEASE, id);
+
+    if (longPressMask & bit)
+    {
+        tapArmedMask &= ~bit;
+        return;
+    }
+
+    if ((tapArmedMask & bit) && tapTimers[id].elapsed(currentMillis) <= config.doubleTapMs)
+    {
+        tapArmedMask &= ~bit;
+        push(GESTURE_DOUBLE_TAP, id);
+    }
+    else
+    {
+        if (config.doubleTapMs > 0)
+        {
+            tapArmedMask |= bit;
+        }
+        tapTimers[id].start(currentMillis);
+        push(GESTURE_TAP, id);
+    }
+}
+
+void GestureRecognizer::push(uint8_t type, uint8_t sensor, uint8_t value)
+{
+    eventBus->post(EVENT_TOUCH, type, sensor, value);
+}
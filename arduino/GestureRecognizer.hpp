@@ -0,0 +1,52 @@
+#ifndef GESTURERECOGNIZER_HPP
+#define GESTURERECOGNIZER_HPP
+
+#include "EventBus.hpp"
+#include "Timer.hpp"
+#include "TouchBank.hpp"
+#include <Arduino.h>
+
+// 제스처 종류 (EVENT_TOUCH 이벤트의 arg0)
+// EVENT_TOUCH의 value: REPEAT는 반복 횟수, CHORD는 센서 비트마스크
+enum GestureType
+{
+    GESTURE_PRESS,      // 터치 시작
+    GESTURE_RELEASE,    // 터치 해제
+    GESTURE_TAP,        // 롱프레스 전에 해제
+    GESTURE_DOUBLE_TAP, // 탭 후 doubleTapMs 안에 다시 탭
+    GESTURE_LONG_PRESS, // longPressMs 이상 유지 (1회)
+    GESTURE_REPEAT,     // 터치 시작 시 + repeatMs 마다 반복
+    GESTURE_CHORD       // 조합 테이블의 센서들이 함께 눌림
+};
+
+// 센서별 제스처 설정 (0이면 해당 제스처 비활성)
+struct GestureConfig
+{
+    uint16_t repeatMs;
+    uint16_t longPressMs;
+    uint16_t doubleTapMs;
+};
+
+class GestureRecognizer
+{
+private:
+    EventBus *eventBus;
+    const GestureConfig *configs;
+    const uint8_t *chords;
+    uint8_t chordCount;
+
+    uint8_t repeatCounts[TouchBank::MAX_SENSORS];
+    Timer tapTimers[TouchBank::MAX_SENSORS]; // 마지막 탭부터
+    uint8_t longPressMask; // 롱프레스 이벤트를 이미 보낸 센서
+    uint8_t tapArmedMask;  // 더블탭 대기 중인 센서
+
+    void push(uint8_t type, uint8_t sensor, uint8_t value = 0);
+    void updateSensor(TouchBank *bank, uint8_t id, unsigned long currentMillis);
+
+public:
+    GestureRecognizer(EventBus *bus, const GestureConfig *configTable,
+                      const uint8_t *chordTable = 0, uint8_t chordTableSize = 0);
+    void update(TouchBank *bank, unsigned long currentMillis);
+};
+
+#endif
@@ -0,0 +1,166 @@
+#include "IdleManager.hpp"
+#include <avr/sleep.h>
+#include <avr/wdt.h>
+
+#if defined(__AVR__)
+// wiring.c의 millis 카운터 (전원 차단 중 멈춘 시간 보정용)
+extern volatile unsigned long timer0_millis;
+
+static volatile bool watchdogFired = false;
+
+ISR(WDT_vect)
+{
+    watchdogFired = true;
+}
+
+// 깨우기만 하면 되므로 빈 핸들러 (SoftwareSerial은 자체 핸들러를 정의함)
+#if COMMAND_TRANSPORT != COMMAND_TRANSPORT_SOFTWARE
+EMPTY_INTERRUPT(PCINT0_vect)
+EMPTY_INTERRUPT(PCINT1_vect)
+EMPTY_INTERRUPT(PCINT2_vect)
+#endif
+#endif
+
+IdleManager::IdleManager(unsigned long dimTimeoutMs, unsigned long sleepTimeoutMs)
+{
+    this->dimTimeoutMs = dimTimeoutMs;
+    this->sleepTimeoutMs = sleepTimeoutMs;
+    state = IDLE_ACTIVE;
+    wakePinCount = 0;
+    sleepCount = 0;
+    sleptMs = 0;
+}
+
+void IdleManager::addWakePin(uint8_t pin)
+{
+    if (wakePinCount < MAX_WAKE_PINS)
+    {
+        wakePins[wakePinCount++] = pin;
+    }
+}
+
+void IdleManager::setTimeouts(unsigned long dimTimeoutMs, unsigned long sleepTimeoutMs)
+{
+    this->dimTimeoutMs = dimTimeoutMs;
+    this->sleepTimeoutMs = sleepTimeoutMs;
+}
+
+bool IdleManager::activity(unsigned long currentMillis)
+{
+    activityTimer.start(currentMillis);
+
+    if (state == IDLE_ACTIVE)
+    {
+        return false;
+    }
+    state = IDLE_ACTIVE;
+    return true;
+}
+
+bool IdleManager::update(unsigned long currentMillis, bool busy)
+{
+    if (busy)
+    {
+        activityTimer.start(currentMillis);
+    }
+
+    uint32_t idleTime = activityTimer.elapsed(currentMillis);
+    uint8_t newState = IDLE_ACTIVE;
+    if (sleepTimeoutMs > 0 && idleTime >= sleepTimeoutMs)
+    {
+        newState = IDLE_SLEEPING;
+    }
+    else if (dimTimeoutMs > 0 && idleTime >= dimTimeoutMs)
+    {
+        newState = IDLE_DIMMED;
+    }
+
+    // 깨어나는 것은 activity에서만
+    if (newState <= state)
+    {
+        return false;
+    }
+    state = newState;
+    return true;
+}
+
+void IdleManager::idleCpu()
+{
+#if defined(__AVR__)
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    sleep_mode();
+#endif
+}
+
+bool IdleManager::isWakePinHigh()
+{
+    for (uint8_t i = 0; i < wakePinCount; i++)
+    {
+        if (digitalRead(wakePins[i]) == HIGH)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void IdleManager::sleepUntilWake()
+{
+#if defined(__AVR__)
+    // 터치 핀 변화 인터럽트 켜기
+    for (uint8_t i = 0; i < wakePinCount; i++)
+    {
+        uint8_t pin = wakePins[i];
+        *digitalPinToPCMSK(pin) |= bit(digitalPinToPCMSKbit(pin));
+        PCIFR |= bit(digitalPinToPCICRbit(pin));
+        *digitalPinToPCICR(pin) |= bit(digitalPinToPCICRbit(pin));
+    }
+
+    // 워치독을 리셋 대신 8초 인터럽트로 사용
+    cli();
+    MCUSR &= ~_BV(WDRF);
+    WDTCSR = _BV(WDCE) | _BV(WDE);
+    WDTCSR = _BV(WDIE) | _BV(WDP3) | _BV(WDP0);
+    sei();
+
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    sleepCount++;
+
+    while (!isWakePinHigh())
+    {
+        watchdogFired = false;
+
+        cli();
+        sleep_enable();
+#if defined(BODS)
+        sleep_bod_disable();
+#endif
+        sei();
+        sleep_cpu();
+        sleep_disable();
+
+        if (!watchdogFired)
+        {
+            break; // 터치 핀 변화로 깨어남
+        }
+
+        // 잠든 동안 멈춘 millis 보정 (워치독 발진기 오차 약 10%)
+        cli();
+        timer0_millis += WATCHDOG_PERIOD_MS;
+        sei();
+        sleptMs += WATCHDOG_PERIOD_MS;
+    }
+
+    // 워치독, 핀 변화 인터럽트 끄기
+    cli();
+    WDTCSR = _BV(WDCE) | _BV(WDE);
+    WDTCSR = 0;
+    sei();
+
+    for (uint8_t i = 0; i < wakePinCount; i++)
+    {
+        uint8_t pin = wakePins[i];
+        *digitalPinToPCMSK(pin) &= ~bit(digitalPinToPCMSKbit(pin));
+    }
+#endif
+}
@@ -0,0 +1,61 @@
+#ifndef IDLEMANAGER_HPP
+#define IDLEMANAGER_HPP
+
+#include "CommandTransport.hpp"
+#include "Timer.hpp"
+#include <Arduino.h>
+
+// 절전 단계
+enum IdleState
+{
+    IDLE_ACTIVE,  // 정상 동작
+    IDLE_DIMMED,  // LCD 백라이트 끔, 틱 사이 CPU만 쉼 (UART, 타이머 동작)
+    IDLE_SLEEPING // LED/서보 끔, 전원 차단 모드 (터치 핀 변화로 깨어남)
+};
+
+// 무입력 시간에 따른 절전 관리
+// 전원 차단 중에는 millis가 멈추므로 워치독(8초)으로 깨어 시간을 보정한 뒤 다시 잠
+// 전원 차단 중에는 UART 수신으로 깨어나지 않음 (원격 명령은 터치로 깨운 뒤 사용)
+class IdleManager
+{
+public:
+    static const uint8_t MAX_WAKE_PINS = 4;
+    static const uint16_t WATCHDOG_PERIOD_MS = 8000;
+
+private:
+    unsigned long dimTimeoutMs;
+    unsigned long sleepTimeoutMs;
+    Timer activityTimer; // 마지막 입력/바쁜 틱부터
+    uint8_t state;
+
+    uint8_t wakePins[MAX_WAKE_PINS];
+    uint8_t wakePinCount;
+
+    uint16_t sleepCount;
+    unsigned long sleptMs;
+
+    bool isWakePinHigh();
+
+public:
+    IdleManager(unsigned long dimTimeoutMs = 60000, unsigned long sleepTimeoutMs = 300000);
+
+    void addWakePin(uint8_t pin);
+    void setTimeouts(unsigned long dimTimeoutMs, unsigned long sleepTimeoutMs);
+
+    // 입력이 있었음, 절전 중이었으면 true (호출자가 화면 등을 복구)
+    bool activity(unsigned long currentMillis);
+
+    // busy면 무입력 시간을 세지 않음, 단계가 바뀌면 true
+    bool update(unsigned long currentMillis, bool busy);
+
+    // 다음 인터럽트(타이머0은 1ms마다)까지 CPU만 멈춤
+    void idleCpu();
+    // 터치 핀이 바뀔 때까지 전원 차단 모드로 잠 (블로킹)
+    void sleepUntilWake();
+
+    uint8_t getState() { return state; }
+    uint16_t getSleepCount() { return sleepCount; }
+    unsigned long getSleptMs() { return sleptMs; }
+};
+
+#endif
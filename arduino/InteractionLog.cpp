@@ -0,0 +1,173 @@
+#include "InteractionLog.hpp"
+
+InteractionLog::InteractionLog()
+{
+    head = 0;
+    phase = 0;
+    wrapped = false;
+    queueStart = 0;
+    queueCount = 0;
+    writeBuffer[0] = 0;
+    writeBuffer[1] = 0;
+    droppedCount = 0;
+    exporting = false;
+    exportIndex = 0;
+}
+
+uint16_t InteractionLog::readRecord(uint16_t index)
+{
+    uint16_t address = BASE_ADDRESS + index * 2;
+    return EEPROM.read(address) | (EEPROM.read(address + 1) << 8);
+}
+
+void InteractionLog::init(unsigned long currentMillis)
+{
+    eventTimer.start(currentMillis);
+
+    // [0, head)는 이번 바퀴(위상 p), [head, 끝)은 이전 바퀴(!p)
+    // 위상이 모두 같으면 한 바퀴를 다 썼거나 처음 (지워진 칸의 위상은 1) -> 0부터 반대 위상으로
+    uint8_t firstPhase = readRecord(0) >> 15;
+    uint16_t low = 0;
+    uint16_t high = RECORD_COUNT;
+    while (low < high)
+    {
+        uint16_t mid = (low + high) / 2;
+        if ((readRecord(mid) >> 15) == firstPhase)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    if (low < RECORD_COUNT)
+    {
+        head = low;
+        phase = firstPhase;
+        wrapped = readRecord(RECORD_COUNT - 1) != 0xFFFF;
+    }
+    else
+    {
+        head = 0;
+        phase = !firstPhase;
+        wrapped = readRecord(0) != 0xFFFF;
+    }
+
+    log(LOG_BOOT, 0, currentMillis);
+}
+
+void InteractionLog::log(uint8_t type, uint8_t sensor, unsigned long currentMillis)
+{
+    unsigned long seconds = eventTimer.elapsed(currentMillis) / 1000;
+    eventTimer.advance(seconds * 1000); // 남은 ms는 다음 기록으로 넘김
+
+    // 긴 공백은 분 단위 시간 기록으로 먼저 채움
+    while (seconds > MAX_DELTA_S)
+    {
+        unsigned long minutes = seconds / 60;
+        if (minutes > 0xFFF)
+        {
+            minutes = 0xFFF;
+        }
+        enqueue((LOG_TIME << 12) | minutes);
+        seconds -= minutes * 60;
+    }
+
+    enqueue(((uint16_t)(type & 0x07) << 12) | ((sensor & 0x03) << 10) | seconds);
+}
+
+void InteractionLog::enqueue(uint16_t record)
+{
+    if (queueCount >= QUEUE_SIZE)
+    {
+        droppedCount++;
+        return;
+    }
+
+    queue[(queueStart + queueCount) % QUEUE_SIZE] = record;
+    queueCount++;
+}
+
+void InteractionLog::update(EepromWriter *writer)
+{
+    if (queueCount == 0 || writer->isBusy())
+    {
+        return;
+    }
+
+    // 위상 비트가 있는 상위 바이트를 나중에 써서, 쓰다 끊기면 이전 바퀴 기록으로 보이게 함
+    uint16_t record = queue[queueStart] | ((uint16_t)phase << 15);
+    writeBuffer[0] = record & 0xFF;
+    writeBuffer[1] = record >> 8;
+    if (!writer->start(BASE_ADDRESS + head * 2, writeBuffer, 2))
+    {
+        return;
+    }
+
+    queueStart = (queueStart + 1) % QUEUE_SIZE;
+    queueCount--;
+
+    head++;
+    if (head >= RECORD_COUNT)
+    {
+        head = 0;
+        phase = !phase;
+        wrapped = true;
+    }
+}
+
+void InteractionLog::startExport()
+{
+    exporting = true;
+    exportIndex = 0;
+}
+
+void InteractionLog::updateExport(unsigned long currentMillis, CommandProtocol *protocol)
+{
+    if (!exporting)
+    {
+        return;
+    }
+
+    // 오래된 기록부터: 이전 바퀴 [head, 끝) 다음 이번 바퀴 [0, head)
+    uint16_t start = wrapped ? head : 0;
+    uint16_t total = wrapped ? RECORD_COUNT : head;
+
+    uint8_t payload[2 + EXPORT_RECORDS_PER_FRAME * 2];
+    payload[0] = exportIndex & 0xFF;
+    payload[1] = exportIndex >> 8;
+
+    if (exportIndex >= total)
+    {
+        // 끝 표시: [전체 수][0xFF][마지막 기록 후 경과 초 (4바이트)] - 길이가 홀수라 기록 프레임과 구분됨
+        unsigned long seconds = eventTimer.elapsed(currentMillis) / 1000;
+        payload[2] = 0xFF;
+        payload[3] = seconds & 0xFF;
+        payload[4] = (seconds >> 8) & 0xFF;
+        payload[5] = (seconds >> 16) & 0xFF;
+        payload[6] = seconds >> 24;
+        if (protocol->sendFrame(CMD_LOG_DATA, payload, 7))
+        {
+            exporting = false;
+        }
+        return;
+    }
+
+    uint8_t length = 2;
+    uint16_t index = exportIndex;
+    while (index < total && length < sizeof(payload))
+    {
+        uint16_t record = readRecord((start + index) % RECORD_COUNT);
+        payload[length++] = record & 0xFF;
+        payload[length++] = record >> 8;
+        index++;
+    }
+
+    // 송신 버퍼가 가득 차면 다음 틱에 같은 구간을 다시 보냄
+    if (protocol->sendFrame(CMD_LOG_DATA, payload, length))
+    {
+        exportIndex = index;
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef INTERACTIONLOG_HPP
+#define INTERACTIONLOG_HPP
+
+#include "CommandProtocol.hpp"
+#include "EepromWriter.hpp"
+#include "Timer.hpp"
+#include <Arduino.h>
+
+// 기록 종류 (3비트)
+enum LogType
+{
+    LOG_TIME,             // 긴 공백: 12비트 분 단위 경과 시간
+    LOG_BOOT,             // 전원 켜짐 (이전 기록과의 시간 차는 알 수 없음)
+    LOG_TOUCH,            // 터치 (센서 번호)
+    LOG_MISSION_UP,       // 미션 목표 +1 (미션 번호)
+    LOG_MISSION_DOWN,     // 미션 한 번 수행 (미션 번호)
+    LOG_MISSION_COMPLETE, // 미션 완료 (미션 번호)
+    LOG_CHORD             // 조합 터치 (조합 번호)
+};
+
+// 상호작용 기록 EEPROM 링 버퍼 (EEPROM 128~1023, 2바이트 기록 448개)
+// 기록: [위상 1][종류 3][센서 2][이전 기록 후 경과 초 10] (리틀 엔디언)
+// 링을 한 바퀴 돌 때마다 위상 비트가 바뀌므로, 부팅 시 위상이 바뀌는 곳을 이진 탐색해 쓰기 위치를 찾음
+// 0xFFFF는 빈 칸 (지워진 EEPROM)
+class InteractionLog
+{
+public:
+    static const uint16_t BASE_ADDRESS = 128;
+    static const uint16_t RECORD_COUNT = 448;
+    static const uint16_t MAX_DELTA_S = 1022; // 1023은 빈 칸 표시와 겹침
+    static const uint8_t QUEUE_SIZE = 8;
+    static const uint8_t EXPORT_RECORDS_PER_FRAME = 8;
+
+private:
+    uint16_t head;     // 다음에 쓸 기록 번호
+    uint8_t phase;     // 이번 바퀴의 위상 비트
+    bool wrapped;      // head 이후에 이전 바퀴 기록이 있음
+    Timer eventTimer; // 마지막 기록부터 (초 미만은 남김)
+
+    // EEPROM 쓰기 대기열
+    uint16_t queue[QUEUE_SIZE];
+    uint8_t queueStart;
+    uint8_t queueCount;
+    uint8_t writeBuffer[2]; // EepromWriter가 참조
+    uint16_t droppedCount;
+
+    // 내보내기 상태
+    bool exporting;
+    uint16_t exportIndex; // 오래된 것부터 0
+
+    uint16_t readRecord(uint16_t index);
+    void enqueue(uint16_t record);
+
+public:
+    InteractionLog();
+
+    // 부팅 시 쓰기 위치 탐색 (EEPROM 약 9번 읽음)
+    void init(unsigned long currentMillis);
+
+    void log(uint8_t type, uint8_t sensor, unsigned long currentMillis);
+    void update(EepromWriter *writer);
+
+    // 오래된 것부터 CMD_LOG_DATA 프레임으로 내보냄 (틱당 한 프레임)
+    void startExport();
+    void updateExport(unsigned long currentMillis, CommandProtocol *protocol);
+    bool isExporting() { return exporting; }
+
+    bool hasPending() { return queueCount > 0; }
+    uint16_t getHead() { return head; }
+    uint16_t getDroppedCount() { return droppedCount; }
+};
+
+#endif
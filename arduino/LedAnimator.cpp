@@ -0,0 +1,121 @@
+#include "LedAnimator.hpp"
+
+LedAnimator::LedAnimator(Adafruit_NeoPixel *ledStrip, uint16_t frameIntervalMs)
+{
+    strip = ledStrip;
+    effect = LED_EFFECT_NONE;
+    frameInterval = frameIntervalMs;
+    lastFrameKey = 0;
+    frameDrawn = false;
+    started = false;
+    frameResult = 0;
+}
+
+void LedAnimator::start(uint8_t newEffect)
+{
+    effect = newEffect;
+    frameDrawn = false;
+    started = false;
+}
+
+void LedAnimator::stop()
+{
+    effect = LED_EFFECT_NONE;
+}
+
+uint8_t LedAnimator::update(unsigned long currentMillis)
+{
+    if (effect == LED_EFFECT_NONE)
+        return 0;
+
+    // 첫 프레임은 바로 그림
+    if (!started)
+    {
+        started = true;
+        effectTimer.start(currentMillis);
+        nextFrame.set(currentMillis, 0);
+    }
+
+    // 프레임 시각 전이면 아무것도 하지 않음
+    if (!nextFrame.hasPassed(currentMillis))
+        return 0;
+
+    nextFrame.set(currentMillis, frameInterval);
+    frameResult = 0;
+    uint32_t elapsed = effectTimer.elapsed(currentMillis);
+
+    bool running = true;
+    if (effect == LED_EFFECT_RAINBOW)
+    {
+        running = renderRainbow(elapsed);
+    }
+    else if (effect == LED_EFFECT_CELEBRATION)
+    {
+        running = renderCelebration(elapsed);
+    }
+
+    if (!running)
+    {
+        effect = LED_EFFECT_NONE;
+        frameResult |= LED_EFFECT_DONE;
+    }
+    return frameResult;
+}
+
+bool LedAnimator::renderRainbow(unsigned long elapsed)
+{
+    // 기존 rainbowEffect와 같은 진행: 10ms 마다 색상 5 단계, 52 단계
+    unsigned long step = elapsed / 10;
+    if (step > 51)
+    {
+        return false;
+    }
+
+    uint16_t j = step * 5;
+    drawFrame(j, ColorPipeline::HUE_RANGE / strip->numPixels(), j * 6);
+    return true;
+}
+
+bool LedAnimator::renderCelebration(unsigned long elapsed)
+{
+    if (elapsed >= 3000)
+    {
+        return false;
+    }
+
+    // 10ms 마다 색상 1도 회전, 픽셀마다 90도 차이
+    uint16_t hue = (elapsed / 10) % 360;
+    drawFrame(hue, ColorPipeline::HUE_RANGE / 4, hue * 64 / 15); // 도 -> 1536 단계
+    return true;
+}
+
+void LedAnimator::drawFrame(uint16_t frameKey, uint16_t hueStep, uint16_t baseHue)
+{
+    // 프레임 내용이 직전과 같으면 다시 그리지 않음
+    if (frameDrawn && frameKey == lastFrameKey)
+        return;
+
+    frameResult |= LED_FRAME_DRAWN;
+    for (uint16_t i = 0; i < strip->numPixels(); i++)
+    {
+        if (writePixel(strip, i, ColorPipeline::hsv(baseHue + i * hueStep)))
+        {
+            frameResult |= LED_FRAME_CHANGED;
+        }
+    }
+
+    lastFrameKey = frameKey;
+    frameDrawn = true;
+}
+
+bool LedAnimator::writePixel(Adafruit_NeoPixel *ledStrip, uint16_t pixel, uint32_t color)
+{
+    // 출력 버퍼의 원시 바이트끼리 비교
+    uint8_t *raw = ledStrip->getPixels() + pixel * 3;
+    uint8_t b0 = raw[0];
+    uint8_t b1 = raw[1];
+    uint8_t b2 = raw[2];
+
+    ledStrip->setPixelColor(pixel, color);
+    return raw[0] != b0 || raw[1] != b1 || raw[2] != b2;
+}
@@ -0,0 +1,63 @@
+#ifndef LEDANIMATOR_HPP
+#define LEDANIMATOR_HPP
+
+#include "ColorPipeline.hpp"
+#include "Deadline.hpp"
+#include "Timer.hpp"
+#include <Adafruit_NeoPixel.h>
+#include <Arduino.h>
+
+// LED 효과 종류
+enum LedEffect
+{
+    LED_EFFECT_NONE,
+    LED_EFFECT_RAINBOW,     // 초기화 무지개 (약 0.5초, 마지막 프레임 유지)
+    LED_EFFECT_CELEBRATION  // 미션 완료 회전 무지개 (3초 후 소등)
+};
+
+// update() 결과 플래그
+enum LedUpdateResult
+{
+    LED_FRAME_DRAWN = 0x01,   // 프레임을 그림 (버퍼는 안 바뀌었을 수도 있음)
+    LED_FRAME_CHANGED = 0x02, // 픽셀 버퍼가 실제로 바뀜
+    LED_EFFECT_DONE = 0x04    // 효과가 이번 호출에서 끝남
+};
+
+// 프레임 속도가 제한된 비동기 네오픽셀 애니메이션
+// - 효과는 update(currentMillis)로 진행되는 상태 머신
+// - 픽셀 버퍼에만 쓰고 show()는 DisplayManager::commit에서 한 번에
+class LedAnimator
+{
+private:
+    Adafruit_NeoPixel *strip;
+    uint8_t effect;
+    Timer effectTimer;
+    Deadline nextFrame;
+    uint16_t frameInterval;
+    uint16_t lastFrameKey; // 직전 프레임을 결정한 값 (같으면 다시 그리지 않음)
+    bool frameDrawn;
+    bool started; // 시작 시각은 첫 update에서 정해짐
+
+    uint8_t frameResult;
+
+    bool renderRainbow(unsigned long elapsed);
+    bool renderCelebration(unsigned long elapsed);
+    void drawFrame(uint16_t frameKey, uint16_t hueStep, uint16_t baseHue);
+
+public:
+    LedAnimator(Adafruit_NeoPixel *ledStrip, uint16_t frameIntervalMs = 33);
+
+    void start(uint8_t newEffect);
+    void stop();
+
+    // LedUpdateResult 플래그 조합 반환
+    uint8_t update(unsigned long currentMillis);
+
+    // 버퍼의 픽셀을 바꾸고, 실제로 값이 바뀌었으면 true
+    static bool writePixel(Adafruit_NeoPixel *ledStrip, uint16_t pixel, uint32_t color);
+
+    bool isRunning() { return effect != LED_EFFECT_NONE; }
+    uint8_t getEffect() { return effect; }
+};
+
+#endif
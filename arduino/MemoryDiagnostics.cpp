@@ -0,0 +1,154 @@
+#include "MemoryDiagnostics.hpp"
+
+// avr-libc 링커 심볼
+extern int __data_start, __heap_start, *__brkval;
+
+MemoryDiagnostics::MemoryDiagnostics(unsigned long reportIntervalMs)
+{
+    paintStart = 0;
+    paintEnd = 0;
+    heapTop = 0;
+    reportInterval = reportIntervalMs;
+    reportPending = false;
+}
+
+uint8_t *MemoryDiagnostics::currentHeapEnd()
+{
+    return (__brkval == 0) ? (uint8_t *)&__heap_start : (uint8_t *)__brkval;
+}
+
+void MemoryDiagnostics::paint()
+{
+    // 지역 변수 주소 = 현재 스택 위치 (객체 밖 포인터 연산을 피해 정수로 계산)
+    uint8_t top;
+    paintStart = currentHeapEnd();
+    paintEnd = (uint8_t *)((uintptr_t)&top - STACK_MARGIN);
+    heapTop = paintStart;
+
+    for (uint8_t *p = paintStart; p < paintEnd; p++)
+    {
+        *p = CANARY;
+    }
+}
+
+void MemoryDiagnostics::update(unsigned long currentMillis)
+{
+    // 힙 최고점은 매 틱 포인터 비교만 (스택 스캔은 보고할 때만)
+    uint8_t *heapEnd = currentHeapEnd();
+    if (heapEnd > heapTop)
+    {
+        heapTop = heapEnd;
+    }
+}
+
+bool MemoryDiagnostics::isReportDue(unsigned long currentMillis)
+{
+    return reportPending || (reportInterval != 0 && reportTimer.hasElapsed(currentMillis, reportInterval));
+}
+
+bool MemoryDiagnostics::sendReport(unsigned long currentMillis, CommandProtocol *protocol)
+{
+    int values[5] = {getStaticRam(), getHeapPeak(), getStackHighWater(), getFreeRam(), getNeverUsedRam()};
+    uint8_t payload[sizeof(values) / sizeof(values[0]) * 2];
+    for (uint8_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        payload[i * 2] = values[i] & 0xFF;
+        payload[i * 2 + 1] = (values[i] >> 8) & 0xFF;
+    }
+
+    if (!protocol->sendFrame(CMD_MEMORY_REPORT, payload, sizeof(payload)))
+    {
+        return false;
+    }
+    reportPending = false;
+    reportTimer.start(currentMillis);
+    return true;
+}
+
+int MemoryDiagnostics::getFreeRam()
+{
+    uint8_t top;
+    return &top - currentHeapEnd();
+}
+
+int MemoryDiagnostics::getStaticRam()
+{
+    return (uint8_t *)&__heap_start - (uint8_t *)&__data_start;
+}
+
+void MemoryDiagnostics::findUnusedGap(uint8_t *&gapStart, uint8_t *&gapEnd)
+{
+    // 스택 프레임 안의 쓰지 않은 지역 변수 자리도 canary로 남지만 짧은 구간이라 제외됨
+    gapStart = paintEnd;
+    gapEnd = paintEnd;
+    uint8_t *runStart = paintStart;
+    for (uint8_t *p = paintStart; p < paintEnd; p++)
+    {
+        if (*p != CANARY)
+        {
+            runStart = p + 1;
+        }
+        else if (p + 1 - runStart > gapEnd - gapStart)
+        {
+            gapStart = runStart;
+            gapEnd = p + 1;
+        }
+    }
+}
+
+int MemoryDiagnostics::getHeapPeak()
+{
+    uint8_t *peak = heapTop;
+    if (paintStart != 0)
+    {
+        uint8_t *gapStart, *gapEnd;
+        findUnusedGap(gapStart, gapEnd);
+        if (gapStart > peak)
+        {
+            peak = gapStart;
+        }
+    }
+    return peak - (uint8_t *)&__heap_start;
+}
+
+int MemoryDiagnostics::getStackHighWater()
+{
+    if (paintStart == 0)
+        return -1;
+
+    // 틈 위쪽 경계부터 RAMEND까지가 스택이 내려온 깊이
+    uint8_t *gapStart, *gapEnd;
+    findUnusedGap(gapStart, gapEnd);
+    return (uint8_t *)RAMEND - gapEnd + 1;
+}
+
+int MemoryDiagnostics::getNeverUsedRam()
+{
+    if (paintStart == 0)
+        return -1;
+
+    uint8_t *gapStart, *gapEnd;
+    findUnusedGap(gapStart, gapEnd);
+    return gapEnd - gapStart;
+}
+
+void MemoryDiagnostics::report(Print &out)
+{
+    out.print(F("RAM static:"));
+    out.print(getStaticRam());
+    out.print(F(" heap:"));
+    out.print(getHeapPeak());
+    out.print(F(" stack:"));
+    out.print(getStackHighWater());
+    out.print(F(" free:"));
+    out.print(getFreeRam());
+    out.print(F(" unused:"));
+    out.println(getNeverUsedRam());
+}
+
+void MemoryDiagnostics::showOnLcd(DisplayManager *display)
+{
+    display->lcdClear();
+    display->lcdPrint(0, 0, "Free:" + String(getFreeRam()) + " Hp:" + String(getHeapPeak()));
+    display->lcdPrint(0, 1, "Stk:" + String(getStackHighWater()) + " Un:" + String(getNeverUsedRam()));
+}
@@ -0,0 +1,58 @@
+#ifndef MEMORYDIAGNOSTICS_HPP
+#define MEMORYDIAGNOSTICS_HPP
+
+#include "CommandProtocol.hpp"
+#include "DisplayManager.hpp"
+#include "Timer.hpp"
+#include <Arduino.h>
+
+// SRAM 사용량 진단
+// - 부팅 시 힙 끝 ~ 스택 사이의 빈 영역을 canary 값으로 칠해 둠
+// - 운영 중 힙 최고점과 스택 최고 수위(high-water mark)를 추적
+// - 보고할 때 칠한 영역에서 가장 긴 canary 구간을 찾음: 힙과 스택이 한 번도 닿지 않은 틈
+//   (같은 틱에 할당, 해제된 String 임시 블록은 __brkval 표본에 안 잡히지만 canary는 지움)
+// - 요청 시 LCD 표시, 보고는 CMD_MEMORY_REPORT 프레임 (요청 시 1회, 주기를 주면 주기적으로)
+class MemoryDiagnostics
+{
+private:
+    static const uint8_t CANARY = 0xC5;
+    static const uint8_t STACK_MARGIN = 32; // 칠할 때 현재 스택 아래로 남겨둘 여유
+
+    uint8_t *paintStart;
+    uint8_t *paintEnd;
+    uint8_t *heapTop;
+    unsigned long reportInterval; // 0 = 주기 보고 끔
+    Timer reportTimer;
+    bool reportPending; // 요청받은 보고 (송신 버퍼가 비면 보냄)
+
+    uint8_t *currentHeapEnd();
+    void findUnusedGap(uint8_t *&gapStart, uint8_t *&gapEnd);
+
+public:
+    MemoryDiagnostics(unsigned long reportIntervalMs = 0);
+
+    // setup()에서 가능한 한 먼저 호출
+    void paint();
+    void update(unsigned long currentMillis);
+
+    void setReportInterval(unsigned long intervalMs) { reportInterval = intervalMs; }
+    unsigned long getReportInterval() { return reportInterval; }
+    void requestReport() { reportPending = true; }
+
+    // 요청이 있거나 보고 주기가 되었으면 true
+    bool isReportDue(unsigned long currentMillis);
+    // 송신 버퍼에 보고 프레임을 넣음, 가득 차면 false (다음 틱에 다시)
+    bool sendReport(unsigned long currentMillis, CommandProtocol *protocol);
+
+    int getFreeRam();        // 현재 힙 끝 ~ 스택 사이
+    int getStaticRam();      // .data + .bss
+    int getHeapPeak();       // 힙이 가장 커졌을 때의 크기 (틈 아래쪽 경계와 __brkval 표본 중 큰 것)
+    int getStackHighWater(); // 스택이 가장 깊었을 때의 크기
+    int getNeverUsedRam();   // 부팅 후 한 번도 쓰이지 않은 영역
+
+    // 명령 링크와 Serial이 다를 때만 사용 (하드웨어 UART면 프레임 사이에 글자가 끼어듦)
+    void report(Print &out);
+    void showOnLcd(DisplayManager *display);
+};
+
+#endif
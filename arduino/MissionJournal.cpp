@@ -0,0 +1,126 @@
+#include "MissionJournal.hpp"
+
+MissionJournal::MissionJournal()
+{
+    memset(recordBuffer, 0, sizeof(recordBuffer));
+    memset(pending, 0, sizeof(pending));
+    memset(saved, 0, sizeof(saved));
+    nextSlot = 0;
+    nextSequence = 0;
+    dirty = false;
+    recordWriteCount = 0;
+}
+
+bool MissionJournal::recover(uint8_t *payload)
+{
+    bool found = false;
+    uint8_t latestSlot = 0;
+    uint8_t latestSequence = 0;
+
+    for (uint8_t slot = 0; slot < SLOT_COUNT; slot++)
+    {
+        uint16_t address = BASE_ADDRESS + slot * RECORD_SIZE;
+        uint8_t crc = CRC_SEED;
+        for (uint8_t i = 0; i < RECORD_SIZE - 1; i++)
+        {
+            crc = crc8Update(crc, EEPROM.read(address + i));
+        }
+        if (crc != EEPROM.read(address + RECORD_SIZE - 1))
+        {
+            continue; // 빈 슬롯이거나 쓰다 만 레코드
+        }
+
+        // 순번은 8비트로 순환하므로 차이의 부호로 비교
+        uint8_t sequence = EEPROM.read(address);
+        if (!found || (int8_t)(sequence - latestSequence) > 0)
+        {
+            found = true;
+            latestSlot = slot;
+            latestSequence = sequence;
+        }
+    }
+
+    if (!found)
+    {
+        return false;
+    }
+
+    uint16_t address = BASE_ADDRESS + latestSlot * RECORD_SIZE + 1;
+    for (uint8_t i = 0; i < PAYLOAD_SIZE; i++)
+    {
+        saved[i] = EEPROM.read(address + i);
+    }
+    memcpy(pending, saved, PAYLOAD_SIZE);
+    memcpy(payload, saved, PAYLOAD_SIZE);
+
+    nextSlot = (latestSlot + 1) % SLOT_COUNT;
+    nextSequence = latestSequence + 1;
+    return true;
+}
+
+void MissionJournal::record(const uint8_t *payload, unsigned long currentMillis)
+{
+    memcpy(pending, payload, PAYLOAD_SIZE);
+
+    // 저장된 값으로 되돌아가면 쓸 필요 없음
+    if (memcmp(pending, saved, PAYLOAD_SIZE) == 0)
+    {
+        dirty = false;
+        return;
+    }
+
+    if (!dirty)
+    {
+        dirty = true;
+        firstChangeTimer.start(currentMillis);
+    }
+    lastChangeTimer.start(currentMillis);
+}
+
+void MissionJournal::update(unsigned long currentMillis, EepromWriter *writer)
+{
+    if (!dirty || writer->isBusy())
+    {
+        return;
+    }
+
+    if (lastChangeTimer.hasElapsed(currentMillis, COALESCE_MS) || firstChangeTimer.hasElapsed(currentMillis, MAX_DELAY_MS))
+    {
+        writeRecord(writer);
+    }
+}
+
+void MissionJournal::flush(EepromWriter *writer)
+{
+    writer->flush();
+    if (dirty && writeRecord(writer))
+    {
+        writer->flush();
+    }
+}
+
+bool MissionJournal::writeRecord(EepromWriter *writer)
+{
+    // 진행 중인 쓰기가 recordBuffer를 읽고 있을 수 있으므로 먼저 확인
+    if (writer->isBusy())
+    {
+        return false;
+    }
+
+    recordBuffer[0] = nextSequence;
+    memcpy(recordBuffer + 1, pending, PAYLOAD_SIZE);
+    recordBuffer[RECORD_SIZE - 1] = crc8(recordBuffer, RECORD_SIZE - 1, CRC_SEED);
+
+    // 받아들여지지 않으면 dirty로 남겨 다음 틱에 다시 시도 (슬롯, 순번 유지)
+    if (!writer->start(BASE_ADDRESS + nextSlot * RECORD_SIZE, recordBuffer, RECORD_SIZE))
+    {
+        return false;
+    }
+
+    memcpy(saved, pending, PAYLOAD_SIZE);
+    dirty = false;
+    nextSlot = (nextSlot + 1) % SLOT_COUNT;
+    nextSequence++;
+    recordWriteCount++;
+    return true;
+}
@@ -0,0 +1,55 @@
+#ifndef MISSIONJOURNAL_HPP
+#define MISSIONJOURNAL_HPP
+
+#include "Crc8.hpp"
+#include "EepromWriter.hpp"
+#include "Timer.hpp"
+#include <Arduino.h>
+
+// 미션 상태 EEPROM 저널 (EEPROM 0~127)
+// 레코드: [순번][데이터 x PAYLOAD_SIZE][CRC8(순번, 데이터), 초기값 CRC_SEED]
+// 매번 다음 슬롯에 새 레코드를 써서 마모를 SLOT_COUNT개 슬롯에 나눔
+// 쓰는 중 전원이 나가도 CRC가 깨진 레코드는 무시하고 직전 레코드로 복구
+class MissionJournal
+{
+public:
+    static const uint16_t BASE_ADDRESS = 0;
+    static const uint8_t PAYLOAD_SIZE = 6;
+    static const uint8_t RECORD_SIZE = PAYLOAD_SIZE + 2;
+    static const uint8_t SLOT_COUNT = 16; // 16 x 8 = 128바이트
+    static const uint8_t CRC_SEED = 0x5A; // 0으로 지워진 슬롯이 유효하게 보이지 않도록
+
+    static const uint16_t COALESCE_MS = 5000;  // 마지막 변경 후 이만큼 조용하면 씀
+    static const uint16_t MAX_DELAY_MS = 30000; // 계속 바뀌어도 이 시간 안에는 씀
+
+private:
+    uint8_t recordBuffer[RECORD_SIZE]; // 쓰는 중인 레코드 (EepromWriter가 참조)
+    uint8_t pending[PAYLOAD_SIZE];
+    uint8_t saved[PAYLOAD_SIZE];
+    uint8_t nextSlot;
+    uint8_t nextSequence;
+    bool dirty;
+    Timer firstChangeTimer;
+    Timer lastChangeTimer;
+    uint16_t recordWriteCount;
+
+    // 쓰기 작업이 시작됐을 때만 true (그때 saved, 슬롯, 순번을 넘김)
+    bool writeRecord(EepromWriter *writer);
+
+public:
+    MissionJournal();
+
+    // 부팅 시 최신 유효 레코드 복구 (슬롯 SLOT_COUNT개만 읽음), 없으면 false
+    bool recover(uint8_t *payload);
+
+    // 새 상태 기록 요청 (바로 쓰지 않고 모아서 씀)
+    void record(const uint8_t *payload, unsigned long currentMillis);
+    void update(unsigned long currentMillis, EepromWriter *writer);
+    // 대기 중인 상태를 즉시 씀
+    void flush(EepromWriter *writer);
+
+    bool isDirty() { return dirty; }
+    uint16_t getRecordWriteCount() { return recordWriteCount; }
+};
+
+#endif
@@ -1,26 +1,139 @@
 #include "MissionManager.hpp"
 
-MissionManager::MissionManager()
+MissionManager::MissionManager(EventBus *bus, const MissionConfig *configTable, uint8_t count)
 {
-    missionCompleted = false;
+    eventBus = bus;
+    configs = configTable;
+    missionCount = count > MAX_MISSIONS ? MAX_MISSIONS : count;
+    activeMission = 0;
+
+    for (uint8_t i = 0; i < MAX_MISSIONS; i++)
+    {
+        missions[i].goal = i < missionCount ? configs[i].goal : 0;
+        missions[i].progress = 0;
+    }
+}
+
+void MissionManager::init(unsigned long currentMillis)
+{
+    scheduleTimer.start(currentMillis);
+    for (uint8_t i = 0; i < missionCount; i++)
+    {
+        missions[i].periodTimer.start(currentMillis);
+    }
+}
+
+void MissionManager::update(unsigned long currentMillis)
+{
+    if (!scheduleTimer.hasElapsed(currentMillis, SCHEDULE_CHECK_MS))
+    {
+        return;
+    }
+    scheduleTimer.start(currentMillis);
+
+    for (uint8_t i = 0; i < missionCount; i++)
+    {
+        unsigned long periodMs = configs[i].resetMinutes * 60000UL;
+        if (periodMs == 0 || !missions[i].periodTimer.hasElapsed(currentMillis, periodMs))
+        {
+            continue;
+        }
+
+        missions[i].periodTimer.advance(periodMs * (missions[i].periodTimer.elapsed(currentMillis) / periodMs));
+        missions[i].goal = configs[i].goal;
+        missions[i].progress = 0;
+        notify(i, MISSION_RESET);
+    }
+}
+
+bool MissionManager::addGoal(uint8_t id)
+{
+    if (id >= missionCount || missions[id].goal == 255)
+    {
+        return false;
+    }
+
+    missions[id].goal++;
+    notify(id, MISSION_GOAL_UP);
+    return true;
+}
+
+bool MissionManager::addProgress(uint8_t id)
+{
+    if (id >= missionCount || getRemaining(id) == 0)
+    {
+        return false;
+    }
+
+    missions[id].progress++;
+    notify(id, MISSION_PROGRESS);
+
+    if (getRemaining(id) == 0)
+    {
+        // 주기가 없는 미션은 바로 비워서 다음 목표를 받음 (주기 미션은 다음 주기까지 완료 상태)
+        if (configs[id].resetMinutes == 0)
+        {
+            missions[id].goal = 0;
+            missions[id].progress = 0;
+        }
+
+        if (eventBus)
+        {
+            eventBus->post(EVENT_MISSION_COMPLETED, id);
+        }
+    }
+    return true;
+}
+
+void MissionManager::selectNext()
+{
+    activeMission = (activeMission + 1) % missionCount;
+    notify(activeMission, MISSION_SELECTED);
 }
 
-void MissionManager::update(int missionCount, int &lastMissionCount)
+int MissionManager::getRemaining(uint8_t id)
 {
-    // 미션 완료 조건 체크
-    if (!missionCompleted && lastMissionCount >= 1 && missionCount == 0)
+    if (id >= missionCount || missions[id].progress >= missions[id].goal)
     {
-        missionCompleted = true;
+        return 0;
     }
-    lastMissionCount = missionCount;
+    return missions[id].goal - missions[id].progress;
 }
 
-bool MissionManager::isMissionCompleted()
+bool MissionManager::isCompleted(uint8_t id)
 {
-    return missionCompleted;
+    return id < missionCount && missions[id].goal > 0 && missions[id].progress >= missions[id].goal;
 }
 
-void MissionManager::resetMissionCompleted()
+void MissionManager::save(uint8_t *state)
 {
-    missionCompleted = false;
-}
\ No newline at end of file
+    for (uint8_t i = 0; i < MAX_MISSIONS; i++)
+    {
+        state[i * 2] = missions[i].goal;
+        state[i * 2 + 1] = missions[i].progress;
+    }
+}
+
+void MissionManager::load(const uint8_t *state)
+{
+    for (uint8_t i = 0; i < missionCount; i++)
+    {
+        missions[i].goal = state[i * 2];
+        missions[i].progress = state[i * 2 + 1];
+
+        // 목표 0은 미션 테이블 이전 레코드(미션 1개만 저장)의 빈 자리 - 기본 목표로 시작
+        if (missions[i].goal == 0)
+        {
+            missions[i].goal = configs[i].goal;
+            missions[i].progress = 0;
+        }
+    }
+}
+
+void MissionManager::notify(uint8_t id, uint8_t change)
+{
+    if (eventBus)
+    {
+        eventBus->post(EVENT_MISSION_CHANGED, id, change, getRemaining(id));
+    }
+}
@@ -1,18 +1,74 @@
 #ifndef MISSIONMANAGER_HPP
 #define MISSIONMANAGER_HPP
 
+#include "EventBus.hpp"
+#include "Timer.hpp"
 #include <Arduino.h>
 
+// 미션 설정 (고정 테이블)
+struct MissionConfig
+{
+    uint8_t goal;          // 기본 목표 횟수 (0 = 터치로 정함)
+    uint16_t resetMinutes; // 진행 초기화 주기 (0 = 없음, 1440 = 하루), RTC가 없어 전원 켠 뒤부터 계산
+};
+
+// 미션 변경 종류 (EVENT_MISSION_CHANGED의 arg1)
+enum MissionChange
+{
+    MISSION_GOAL_UP,  // 목표 +1 (부모)
+    MISSION_PROGRESS, // 한 번 수행 (아이)
+    MISSION_RESET,    // 주기가 지나 진행 초기화
+    MISSION_SELECTED  // 표시할 미션 변경 / 복구
+};
+
+// 미션 테이블 관리
+// 진행 이벤트가 들어올 때만 평가하고, 초기화 주기는 1분에 한 번만 확인
 class MissionManager
 {
+public:
+    static const uint8_t MAX_MISSIONS = 3;
+    static const uint8_t STATE_SIZE = MAX_MISSIONS * 2; // save/load 바이트 수
+    static const uint16_t SCHEDULE_CHECK_MS = 60000;
+
 private:
-    bool missionCompleted;
+    struct MissionState
+    {
+        uint8_t goal;
+        uint8_t progress;
+        Timer periodTimer; // 현재 초기화 주기 시작부터
+    };
+
+    EventBus *eventBus;
+    const MissionConfig *configs;
+    uint8_t missionCount;
+    MissionState missions[MAX_MISSIONS];
+    uint8_t activeMission;
+    Timer scheduleTimer;
+
+    void notify(uint8_t id, uint8_t change);
 
 public:
-    MissionManager();
-    void update(int missionCount, int &lastmissionCount);
-    bool isMissionCompleted();
-    void resetMissionCompleted();
+    MissionManager(EventBus *bus, const MissionConfig *configTable, uint8_t count);
+
+    void init(unsigned long currentMillis);
+    // 초기화 주기 확인 (SCHEDULE_CHECK_MS마다)
+    void update(unsigned long currentMillis);
+
+    // 목표 +1, 완료된 미션이면 다시 진행 중이 됨
+    bool addGoal(uint8_t id);
+    // 남은 횟수 -1, 0이 되면 EVENT_MISSION_COMPLETED (남은 것이 없으면 false)
+    bool addProgress(uint8_t id);
+    void selectNext();
+
+    uint8_t getActiveMission() { return activeMission; }
+    uint8_t getMissionCount() { return missionCount; }
+    int getRemaining(uint8_t id);
+    bool isCompleted(uint8_t id);
+
+    // 저널 저장/복구용 [목표][진행] x MAX_MISSIONS
+    // 복구 때 목표가 0이면 기본 목표로 (이전 형식 레코드)
+    void save(uint8_t *state);
+    void load(const uint8_t *state);
 };
 
 #endif
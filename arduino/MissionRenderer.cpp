@@ -0,0 +1,99 @@
+#include "MissionRenderer.hpp"
+
+// 단계별 색 (선형 RGB)
+static const uint8_t tierColors[MissionRenderer::TIER_COUNT][3] = {
+    {0, 255, 0}, // 초록
+    {0, 0, 255}, // 파랑
+    {255, 0, 0}, // 빨강
+};
+
+MissionRenderer::MissionRenderer(uint16_t neoCount, uint16_t perTier)
+{
+    pixelCount = neoCount;
+    missionsPerTier = perTier > 0 ? perTier : neoCount;
+    if (missionsPerTier == 0)
+    {
+        missionsPerTier = 1; // 빈 스트립에서도 나눗셈이 안전하도록
+    }
+    tier = -1;
+    fillLevel = 0;
+    valid = false;
+}
+
+bool MissionRenderer::update(int missionCount, uint16_t &firstPixel, uint16_t &lastPixel)
+{
+    if (pixelCount == 0)
+        return false;
+
+    // 마지막 단계가 가득 차면 더 늘지 않음 (우노의 int는 16비트라 long으로 계산)
+    long count = missionCount;
+    long maxCount = (long)TIER_COUNT * missionsPerTier;
+    if (count > maxCount)
+    {
+        count = maxCount;
+    }
+
+    int8_t newTier = -1;
+    uint32_t newLevel = 0;
+    if (count > 0)
+    {
+        newTier = (count - 1) / missionsPerTier;
+        uint32_t inTier = count - (long)newTier * missionsPerTier;
+        // inTier * pixelCount * 256 / missionsPerTier를 32비트 안에서 (몫과 나머지로 나눠 계산)
+        uint32_t scaled = inTier * pixelCount;
+        newLevel = scaled / missionsPerTier * 256 + (scaled % missionsPerTier) * 256 / missionsPerTier;
+    }
+
+    if (valid && newTier == tier && newLevel == fillLevel)
+        return false;
+
+    if (!valid || newTier != tier)
+    {
+        // 단계가 바뀌면 배경색도 바뀌므로 전체
+        firstPixel = 0;
+        lastPixel = pixelCount - 1;
+    }
+    else
+    {
+        // 같은 단계 안에서는 채움 경계 사이의 픽셀만
+        uint32_t low = min(newLevel, fillLevel);
+        uint32_t high = max(newLevel, fillLevel);
+        firstPixel = low >> 8;
+        lastPixel = min((uint32_t)(high >> 8), (uint32_t)(pixelCount - 1));
+    }
+
+    tier = newTier;
+    fillLevel = newLevel;
+    valid = true;
+    return true;
+}
+
+uint32_t MissionRenderer::colorAt(uint16_t pixel)
+{
+    if (tier < 0)
+        return 0;
+
+    const uint8_t *color = tierColors[tier];
+    uint32_t pixelStart = (uint32_t)pixel << 8;
+
+    if (pixelStart + 256 <= fillLevel)
+    {
+        return ColorPipeline::rgb(color[0], color[1], color[2]);
+    }
+
+    // 이전 단계 색 (첫 단계면 꺼짐)
+    static const uint8_t off[3] = {0, 0, 0};
+    const uint8_t *background = tier > 0 ? tierColors[tier - 1] : off;
+
+    if (pixelStart < fillLevel)
+    {
+        // 경계 픽셀: 채운 비율만큼 현재 단계 색과 배경색을 섞음
+        uint16_t fraction = fillLevel - pixelStart;
+        uint16_t rest = 256 - fraction;
+        return ColorPipeline::rgb((color[0] * fraction + background[0] * rest) >> 8,
+                                  (color[1] * fraction + background[1] * rest) >> 8,
+                                  (color[2] * fraction + background[2] * rest) >> 8);
+    }
+
+    return ColorPipeline::rgb(background[0], background[1], background[2]);
+}
@@ -0,0 +1,39 @@
+#ifndef MISSIONRENDERER_HPP
+#define MISSIONRENDERER_HPP
+
+#include "ColorPipeline.hpp"
+#include <Arduino.h>
+
+// 미션 개수를 임의 길이의 LED 스트립에 표시
+// - missionsPerTier 개마다 색 단계가 바뀜 (초록 -> 파랑 -> 빨강), 새 단계가 이전 단계를 덮어씀
+// - 한 미션이 픽셀 경계에 걸치면 마지막 픽셀은 비율만큼 어둡게
+// - 바뀐 픽셀 범위만 다시 계산
+class MissionRenderer
+{
+public:
+    static const uint8_t TIER_COUNT = 3;
+
+private:
+    uint16_t pixelCount;
+    uint16_t missionsPerTier; // 스트립 전체를 한 단계로 채우는 미션 수
+
+    // 현재 그려진 상태
+    int8_t tier;         // -1: 미션 없음
+    uint32_t fillLevel;  // 현재 단계가 채운 길이 (픽셀 x 256, 256픽셀 이상도 담도록 32비트)
+    bool valid;          // false면 다음 update에서 전체를 다시 그림
+
+public:
+    // perTier가 0이면 픽셀 하나에 미션 하나
+    MissionRenderer(uint16_t neoCount, uint16_t perTier = 0);
+
+    // 다시 그려야 할 픽셀 범위를 구함, 바뀐 것이 없으면 false
+    bool update(int missionCount, uint16_t &firstPixel, uint16_t &lastPixel);
+
+    // update 이후 픽셀 색
+    uint32_t colorAt(uint16_t pixel);
+
+    // 다른 효과가 픽셀을 덮어썼을 때 호출
+    void invalidate() { valid = false; }
+};
+
+#endif
@@ -4,8 +4,6 @@ PassiveBuzzerManager::PassiveBuzzerManager(int pin)
 {
     buzzerPin = pin;
     isPlaying = false;
-    playStartTime = 0;
-    currentNoteStartTime = 0;
     currentNoteIndex = 0;
     queueStart = 0;
     queueEnd = 0;
@@ -28,8 +26,7 @@ void PassiveBuzzerManager::update(unsigned long currentMillis)
     // 첫 번째 노트 시작
     if (currentNoteIndex == 0 && !noteActive)
     {
-        playStartTime = currentMillis;
-        currentNoteStartTime = currentMillis;
+        noteTimer.start(currentMillis);
         noteActive = true;
 
         MelodyNote &note = melodyQueue[queueStart];
@@ -48,7 +45,7 @@ void PassiveBuzzerManager::update(unsigned long currentMillis)
     {
         MelodyNote &currentNote = melodyQueue[(queueStart + currentNoteIndex) % MAX_NOTES];
 
-        if (currentMillis - currentNoteStartTime >= currentNote.duration)
+        if (noteTimer.hasElapsed(currentMillis, currentNote.duration))
         {
             // 현재 노트 종료
             noTone(buzzerPin);
@@ -64,7 +61,7 @@ void PassiveBuzzerManager::update(unsigned long currentMillis)
             else
             {
                 // 다음 노트 시작 준비
-                currentNoteStartTime = currentMillis;
+                noteTimer.start(currentMillis);
                 noteActive = true;
 
                 MelodyNote &nextNote = melodyQueue[(queueStart + currentNoteIndex) % MAX_NOTES];
@@ -161,6 +158,14 @@ bool PassiveBuzzerManager::isQueueFull()
     return queueSize >= MAX_NOTES;
 }
 
+bool PassiveBuzzerManager::isToneSounding()
+{
+    if (!isPlaying || !noteActive)
+        return false;
+
+    return melodyQueue[(queueStart + currentNoteIndex) % MAX_NOTES].frequency > 0;
+}
+
 void PassiveBuzzerManager::playBeep(int frequency, int duration)
 {
     addNote(frequency, duration);
@@ -535,9 +540,15 @@ void PassiveBuzzerManager::playBrahmsLullaby()
 void PassiveBuzzerManager::playRandom()
 {
     // 랜덤 멜로디 재생 (0~8 사이의 랜덤 숫자)
-    int randomMelody = random(0, 9);
+    playMelody(random(0, 9));
+}
 
-    switch (randomMelody)
+bool PassiveBuzzerManager::playMelody(int index)
+{
+    if (index < 0 || index >= MELODY_COUNT)
+        return false;
+
+    switch (index)
     {
     case 0:
         playSuccess();
@@ -566,8 +577,18 @@ void PassiveBuzzerManager::playRandom()
     case 8:
         playBrahmsLullaby();
         break;
-    default:
-        playBeep(1000, 200); // 기본 비프음
+    case 9:
+        playGreensleeves();
+        break;
+    case 10:
+        playAuLaitClair();
+        break;
+    case 11:
+        playError();
+        break;
+    case 12:
+        playStartup();
         break;
     }
-}
\ No newline at end of file
+    return true;
+}
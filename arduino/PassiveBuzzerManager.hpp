@@ -1,6 +1,7 @@
 #ifndef PASSIVEBUZZERMANAGER_HPP
 #define PASSIVEBUZZERMANAGER_HPP
 
+#include "Timer.hpp"
 #include <Arduino.h>
 
 struct MelodyNote
@@ -14,8 +15,7 @@ class PassiveBuzzerManager
 private:
     int buzzerPin;
     bool isPlaying;
-    unsigned long playStartTime;
-    unsigned long currentNoteStartTime;
+    Timer noteTimer; // 현재 노트 시작부터
     int currentNoteIndex;
 
     // 멜로디 큐 (최대 32개 노트)
@@ -48,6 +48,7 @@ public:
     bool getIsPlaying();
     int getQueueSize();
     bool isQueueFull();
+    bool isToneSounding(); // 휴지표가 아닌 음이 출력 중
 
     // 미리 정의된 멜로디들
     void playBeep(int frequency = 1000, int duration = 200);
@@ -67,6 +68,10 @@ public:
     void playAuLaitClair();
     void playBrahmsLullaby();
     void playRandom();
+
+    // 번호로 멜로디 재생 (원격 명령용), 없는 번호면 false
+    static const int MELODY_COUNT = 13; // playMelody의 case 수와 같아야 함
+    bool playMelody(int index);
 };
 
 #endif
@@ -1,12 +1,15 @@
 #include "ServoAsync.hpp"
 
-ServoAsync::ServoAsync(ServoController *controller)
+ServoAsync::ServoAsync(ServoController *controller, EventBus *bus)
 {
     servoController = controller;
+    eventBus = bus;
     isAnimating = false;
-    animationStartTime = 0;
     animationDuration = 0;
     animationType = 0;
+#if SONEEBOT_SERVO_STREAM
+    stream = 0;
+#endif
 }
 
 void ServoAsync::update(unsigned long currentMillis)
@@ -14,7 +17,7 @@ void ServoAsync::update(unsigned long currentMillis)
     if (!isAnimating)
         return;
 
-    unsigned long elapsed = currentMillis - animationStartTime;
+    uint32_t elapsed = animationTimer.elapsed(currentMillis);
 
     if (animationType == 1) // Mission complete animation
     {
@@ -45,8 +48,7 @@ void ServoAsync::update(unsigned long currentMillis)
         }
         else
         {
-            servoController->resetToDefault();
-            isAnimating = false;
+            finishAnimation();
         }
     }
     else if (animationType == 2) // Random motion
@@ -54,8 +56,7 @@ void ServoAsync::update(unsigned long currentMillis)
         if (elapsed >= animationDuration)
         {
             // 애니메이션 시간이 끝나면 원래 위치로 복귀
-            servoController->resetToDefault();
-            isAnimating = false;
+            finishAnimation();
         }
     }
     else if (animationType == 3) // Mission decrease motion
@@ -63,16 +64,52 @@ void ServoAsync::update(unsigned long currentMillis)
         if (elapsed >= animationDuration)
         {
             // 애니메이션 시간이 끝나면 원래 위치로 복귀
-            servoController->resetToDefault();
-            isAnimating = false;
+            finishAnimation();
         }
     }
+#if SONEEBOT_SERVO_STREAM
+    else if (animationType == 4) // Remote stream
+    {
+        uint8_t angle1, angle2;
+        uint8_t state = stream->update(currentMillis, angle1, angle2);
+
+        if (state == STREAM_PLAYING)
+        {
+            servoController->moveServo1(angle1);
+            servoController->moveServo2(angle2);
+        }
+        else if (state != STREAM_WAITING)
+        {
+            // 스트림이 끝났거나 중단됨
+            finishAnimation();
+        }
+    }
+#endif
+}
+
+void ServoAsync::finishAnimation()
+{
+    servoController->resetToDefault();
+    isAnimating = false;
+
+    if (eventBus)
+    {
+        eventBus->post(EVENT_ANIMATION_FINISHED, ANIMATION_SERVO);
+    }
 }
 
 void ServoAsync::startMissionCompleteAnimation(unsigned long currentMillis)
 {
+#if SONEEBOT_SERVO_STREAM
+    // 원격 스트림은 중단 (호스트는 크레딧 보고의 IDLE 상태로 알게 됨)
+    if (isAnimating && animationType == 4)
+    {
+        stream->reset();
+    }
+#endif
+
     isAnimating = true;
-    animationStartTime = currentMillis;
+    animationTimer.start(currentMillis);
     animationDuration = 4000;
     animationType = 1;
 }
@@ -99,7 +136,7 @@ void ServoAsync::startRandomMotion(int servoNum, unsigned long currentMillis)
     }
 
     isAnimating = true;
-    animationStartTime = currentMillis;
+    animationTimer.start(currentMillis);
     animationDuration = 450; // 450ms 후 원래 위치로 복귀
     animationType = 2;
 }
@@ -114,11 +151,22 @@ void ServoAsync::startMissionDecraseMotion(unsigned long currentMillis)
     servoController->moveServo2(90);
 
     isAnimating = true;
-    animationStartTime = currentMillis;
+    animationTimer.start(currentMillis);
     animationDuration = 450; // 450ms 후 원래 위치로 복귀
     animationType = 3;
 }
 
+#if SONEEBOT_SERVO_STREAM
+void ServoAsync::startStream(ServoStream *servoStream, unsigned long currentMillis)
+{
+    stream = servoStream;
+    isAnimating = true;
+    animationTimer.start(currentMillis);
+    animationDuration = 0; // 스트림이 끝날 때까지
+    animationType = 4;
+}
+#endif
+
 bool ServoAsync::isAnimationRunning()
 {
     return isAnimating;
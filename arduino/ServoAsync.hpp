@@ -1,24 +1,38 @@
 #ifndef SERVOASYNC_HPP
 #define SERVOASYNC_HPP
 
+#include "EventBus.hpp"
 #include "ServoController.hpp"
+#include "ServoStream.hpp"
+#include "SoneeBotConfig.hpp"
+#include "Timer.hpp"
 #include <Arduino.h>
 
 class ServoAsync
 {
 private:
     ServoController *servoController;
+    EventBus *eventBus;
     bool isAnimating;
-    unsigned long animationStartTime;
+    Timer animationTimer;
     unsigned long animationDuration;
     int animationType;
+#if SONEEBOT_SERVO_STREAM
+    ServoStream *stream;
+#endif
+
+    void finishAnimation();
 
 public:
-    ServoAsync(ServoController *controller);
+    ServoAsync(ServoController *controller, EventBus *bus = 0);
     void update(unsigned long currentMillis);
     void startMissionCompleteAnimation(unsigned long currentMillis);
     void startRandomMotion(int servoNum, unsigned long currentMillis);
     void startMissionDecraseMotion(unsigned long currentMillis);
+#if SONEEBOT_SERVO_STREAM
+    // 호스트가 보내는 궤적 재생 (다른 애니메이션보다 우선)
+    void startStream(ServoStream *servoStream, unsigned long currentMillis);
+#endif
     bool isAnimationRunning();
 };
 
@@ -40,8 +40,34 @@ int ServoController::getServo2Angle()
     return servo2Angle;
 }
 
+void ServoController::detach()
+{
+    servo1.detach();
+    servo2.detach();
+}
+
 void ServoController::resetToDefault()
 {
     moveServo1(30);
     moveServo2(150);
 }
+
+bool ServoController::isPulseWindowIdle(uint16_t durationUs)
+{
+#if defined(TCNT1)
+    // Servo 라이브러리는 Timer1(0.5us/틱)로 20ms 프레임 시작에 채널 순서대로 펄스를 냄
+    const uint16_t FRAME_US = 20000;
+    const uint16_t MARGIN_US = 100;
+
+    uint8_t oldSREG = SREG;
+    cli();
+    uint16_t frameTicks = TCNT1;
+    SREG = oldSREG;
+
+    uint16_t nowUs = frameTicks / 2;
+    uint16_t pulsesEndUs = servo1.readMicroseconds() + servo2.readMicroseconds() + MARGIN_US;
+    return nowUs > pulsesEndUs && nowUs + durationUs + MARGIN_US < FRAME_US;
+#else
+    return true;
+#endif
+}
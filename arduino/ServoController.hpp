@@ -22,6 +22,11 @@ public:
     int getServo1Angle();
     int getServo2Angle();
     void resetToDefault();
+    void detach(); // 절전용, init()으로 다시 연결
+
+    // 서보 펄스 구간이 끝나 다음 프레임 전까지 durationUs 만큼 여유가 있으면 true
+    // (이 구간에서 인터럽트를 막아도 펄스 폭이 흔들리지 않음)
+    bool isPulseWindowIdle(uint16_t durationUs);
 };
 
 #endif
@@ -0,0 +1,129 @@
+#include "ServoStream.hpp"
+
+ServoStream::ServoStream()
+{
+    underrunCount = 0;
+    overflowCount = 0;
+    reset();
+    creditPending = false;
+}
+
+void ServoStream::begin()
+{
+    reset();
+    state = STREAM_WAITING;
+}
+
+void ServoStream::end()
+{
+    if (state != STREAM_IDLE)
+    {
+        ending = true;
+    }
+}
+
+void ServoStream::reset()
+{
+    head = 0;
+    count = 0;
+    state = STREAM_IDLE;
+    ending = false;
+    starved = false;
+    consumedCount = 0;
+    creditPending = true;
+}
+
+bool ServoStream::push(uint16_t time, uint8_t angle1, uint8_t angle2)
+{
+    if (count >= CAPACITY)
+    {
+        overflowCount++;
+        return false;
+    }
+
+    ServoSetpoint &point = points[(head + count) % CAPACITY];
+    point.time = time;
+    point.angle1 = angle1;
+    point.angle2 = angle2;
+    count++;
+    return true;
+}
+
+void ServoStream::pop()
+{
+    head = (head + 1) % CAPACITY;
+    count--;
+    consumedCount++;
+    creditPending = true;
+}
+
+uint8_t ServoStream::update(unsigned long currentMillis, uint8_t &angle1, uint8_t &angle2)
+{
+    if (state == STREAM_WAITING)
+    {
+        if (count >= PREFILL || (ending && count > 0))
+        {
+            // 첫 설정점 시간이 지금이 되도록 재생 시계 맞춤
+            playTimer.start(currentMillis - points[head].time);
+            state = STREAM_PLAYING;
+            creditPending = true;
+        }
+        else if (ending)
+        {
+            state = STREAM_FINISHED;
+            creditPending = true;
+        }
+    }
+
+    if (state != STREAM_PLAYING)
+    {
+        return state;
+    }
+
+    uint16_t streamTime = playTimer.elapsed(currentMillis);
+
+    // 다음 설정점 시간이 지났으면 앞의 것은 버림 (늦게 온 설정점도 여기서 따라잡음)
+    while (count >= 2 && (int16_t)(streamTime - points[(head + 1) % CAPACITY].time) >= 0)
+    {
+        pop();
+    }
+
+    if (count == 0)
+    {
+        state = STREAM_FINISHED;
+        creditPending = true;
+        return state;
+    }
+
+    const ServoSetpoint &from = points[head];
+    int16_t elapsed = streamTime - from.time;
+
+    if (count >= 2 && elapsed > 0)
+    {
+        const ServoSetpoint &to = points[(head + 1) % CAPACITY];
+        uint16_t span = to.time - from.time;
+        angle1 = from.angle1 + (int16_t)(to.angle1 - from.angle1) * (int32_t)elapsed / span;
+        angle2 = from.angle2 + (int16_t)(to.angle2 - from.angle2) * (int32_t)elapsed / span;
+        starved = false;
+        return state;
+    }
+
+    angle1 = from.angle1;
+    angle2 = from.angle2;
+
+    if (count == 1 && elapsed >= 0)
+    {
+        if (ending)
+        {
+            pop(); // 마지막 설정점까지 출력함
+        }
+        else if (!starved)
+        {
+            // 다음 설정점이 아직 안 옴 - 마지막 각도 유지
+            starved = true;
+            underrunCount++;
+        }
+    }
+
+    return state;
+}
@@ -0,0 +1,77 @@
+#ifndef SERVOSTREAM_HPP
+#define SERVOSTREAM_HPP
+
+#include "Timer.hpp"
+#include <Arduino.h>
+
+// 호스트가 보내는 서보 설정점 (시간은 스트림 시작 기준 ms, 16비트로 순환)
+struct ServoSetpoint
+{
+    uint16_t time;
+    uint8_t angle1;
+    uint8_t angle2;
+};
+
+enum ServoStreamState
+{
+    STREAM_IDLE,     // 스트림 없음
+    STREAM_WAITING,  // 미리 채우는 중
+    STREAM_PLAYING,  // 재생 중
+    STREAM_FINISHED  // 종료 요청 후 버퍼를 모두 소진
+};
+
+// 원격 서보 궤적용 지터 버퍼
+// PREFILL 개가 쌓이면 재생 시계를 시작하고, 인접한 두 설정점 사이를 선형 보간
+// 소비한 개수를 크레딧으로 돌려주어 호스트가 빈 칸만큼만 보내게 함
+class ServoStream
+{
+public:
+    static const uint8_t CAPACITY = 16;
+    static const uint8_t PREFILL = 4;
+
+private:
+    ServoSetpoint points[CAPACITY];
+    uint8_t head;
+    uint8_t count;
+    uint8_t state;
+    bool ending;
+    bool starved;
+    Timer playTimer; // 스트림 시각 0부터
+
+    // 크레딧 (호스트는 CAPACITY - (보낸 수 - 소비한 수)만큼 보낼 수 있음)
+    uint8_t consumedCount; // 8비트로 순환
+    bool creditPending;
+
+    uint16_t underrunCount;
+    uint16_t overflowCount;
+
+    void pop();
+
+public:
+    ServoStream();
+
+    // 새 스트림 시작 (버퍼와 크레딧 초기화)
+    void begin();
+    // 남은 설정점을 재생한 뒤 종료
+    void end();
+    // 즉시 중단
+    void reset();
+
+    // 빈 칸이 없으면 false
+    bool push(uint16_t time, uint8_t angle1, uint8_t angle2);
+
+    // 재생 시계를 진행하고 현재 각도를 계산, ServoStreamState 반환
+    uint8_t update(unsigned long currentMillis, uint8_t &angle1, uint8_t &angle2);
+
+    uint8_t getState() { return state; }
+    uint8_t getFree() { return CAPACITY - count; }
+    uint8_t getConsumedCount() { return consumedCount; }
+    uint16_t getUnderrunCount() { return underrunCount; }
+    uint16_t getOverflowCount() { return overflowCount; }
+
+    // 크레딧/상태 보고가 필요하면 true, 보낸 뒤 clearCreditPending
+    bool isCreditPending() { return creditPending; }
+    void clearCreditPending() { creditPending = false; }
+};
+
+#endif
@@ -1,214 +1,719 @@
 #include "SoneeBot.hpp"
 
-SoneeBot::SoneeBot(int s1Pin, int s2Pin, int neoPin, int neoCount,
-                   int t1Pin, int t2Pin, int t3Pin, int buzPin)
+// 실행 중 인덱스로 읽으므로 정의 필요 (C++11)
+constexpr uint8_t SoneeBotConfig::touchPins[];
+
+// 센서별 제스처 설정 (반복 간격, 롱프레스, 더블탭 간격) - addSensor 순서와 동일
+static const GestureConfig touchGestureConfigs[] = {
+    {500, 1000, 300}, // touch1: 미션 감소
+    {500, 1000, 300}, // touch2: 미션 증가
+    {0, 1000, 0},     // touch3: 탭 = 랜덤 서보, 롱프레스 = 미션 전환 (반복 없음)
+};
+
+// 조합 터치 테이블 (센서 비트마스크)
+static const uint8_t touchChords[] = {
+    0b011, // touch1 + touch2
+    0b110, // touch2 + touch3
+};
+
+// 미션 테이블 (기본 목표 횟수, 초기화 주기 분) - 저널에는 미션당 2바이트, 최대 3개
+// touch3 롱프레스로 표시할 미션 전환
+static const MissionConfig missionConfigs[] = {
+    {0, 0},    // 미션 1: 터치로 목표를 정함
+    {2, 1440}, // 미션 2: 하루 2번 (양치)
+    {3, 1440}, // 미션 3: 하루 3번 (채소 먹기)
+};
+
+const EventRoute<SoneeBot> SoneeBot::eventRoutes[] = {
+    {EVENT_TOUCH, &SoneeBot::onTouch},
+    {EVENT_MISSION_CHANGED, &SoneeBot::onMissionChanged},
+    {EVENT_MISSION_COMPLETED, &SoneeBot::onMissionCompleted},
+    {EVENT_ANIMATION_FINISHED, &SoneeBot::onAnimationFinished},
+};
+
+SoneeBot::SoneeBot()
+    : gestures(&eventBus, touchGestureConfigs, touchChords, sizeof(touchChords)),
+      servoController(SoneeBotConfig::servo1Pin, SoneeBotConfig::servo2Pin),
+      servoAsync(&servoController, &eventBus),
+      displayManager(SoneeBotConfig::neoPixelPin, SoneeBotConfig::neoPixelCount, &eventBus,
+                     SoneeBotConfig::missionsPerTier),
+      missionManager(&eventBus, missionConfigs, sizeof(missionConfigs) / sizeof(missionConfigs[0])),
+      buzzerManager(SoneeBotConfig::buzzerPin)
 {
-    // 모듈 객체 생성
-    touch1 = new TouchSensor(t1Pin);
-    touch2 = new TouchSensor(t2Pin);
-    touch3 = new TouchSensor(t3Pin);
-    servoController = new ServoController(s1Pin, s2Pin);
-    servoAsync = new ServoAsync(servoController);
-    displayManager = new DisplayManager(neoPin, neoCount);
-    missionManager = new MissionManager();
-    // buzzerManager = new BuzzerManager(buzPin);
-    buzzerManager = new PassiveBuzzerManager(buzPin);
-}
+    // 설정의 핀 목록 순서대로 등록 (readTouchPins도 TouchBank의 등록 순서로 비트를 만듦)
+    uint8_t ids[SoneeBotConfig::touchCount];
+    for (uint8_t i = 0; i < SoneeBotConfig::touchCount; i++)
+    {
+        ids[i] = touchBank.addSensor(SoneeBotConfig::touchPins[i]);
+        idleManager.addWakePin(SoneeBotConfig::touchPins[i]);
+    }
+    touch1 = ids[0];
+    touch2 = ids[1];
+    touch3 = ids[2];
 
-SoneeBot::~SoneeBot()
-{
-    delete touch1;
-    delete touch2;
-    delete touch3;
-    delete servoController;
-    delete servoAsync;
-    delete displayManager;
-    delete missionManager;
-    delete buzzerManager;
+    celebrationPending = false;
+    diagnosticsShown = false;
+    ignoredTouchMask = 0;
+
+    bootStage = BOOT_LCD;
+    inputReadyTime = 0;
+    bootReadyTime = 0;
 }
 
 void SoneeBot::init()
 {
+#if SONEEBOT_MEMORY_DIAGNOSTICS
+    // 스택이 얕은 지금 빈 SRAM을 칠해 둠
+    memoryDiagnostics.paint();
+#endif
+
+    // 명령 전송 계층 시작 (하드웨어 UART면 Serial 전체를 명령 링크가 씀)
+    commandProtocol.begin();
+#if COMMAND_TRANSPORT != COMMAND_TRANSPORT_HARDWARE
+    Serial.begin(115200);
+#endif
+
     // 모든 모듈 초기화
-    touch1->init();
-    touch2->init();
-    touch3->init();
-    servoController->init();
-    displayManager->init();
-    buzzerManager->init();
+    touchBank.init();
+    servoController.init();
+    displayManager.init();
+    buzzerManager.init();
 
     // LED 핀 설정
     pinMode(LED_BUILTIN, OUTPUT);
 
-    // 초기화 완료 효과
-    buzzerManager->addNote(1000, 100);
-    buzzerManager->addNote(0, 50);
-    buzzerManager->addNote(1000, 100);
+    // 전원이 끊기기 전 미션 상태 복구
+    missionManager.init(millis());
+    restoreMissionState();
+
+#if SONEEBOT_INTERACTION_LOG
+    // 상호작용 기록 쓰기 위치 찾기 + 부팅 기록
+    interactionLog.init(millis());
+#endif
+
+    // 초기화 완료 효과 (터치 센서 등록에 실패했으면 에러음)
+    if (!hasAllSensors())
+    {
+        buzzerManager.playError();
+        return;
+    }
+    buzzerManager.addNote(1000, 100);
+    buzzerManager.addNote(0, 50);
+    buzzerManager.addNote(1000, 100);
+
+    // LCD 초기화와 보고는 update에서 (LED 효과, 멜로디와 겹쳐 진행)
+}
+
+void SoneeBot::updateBoot(unsigned long currentMillis)
+{
+    if (bootStage == BOOT_LCD)
+    {
+        // 터치는 이미 이번 틱에 읽었음
+        inputReadyTime = currentMillis;
+        displayManager.initLcd();
+        if (!hasAllSensors())
+        {
+            displayManager.lcdPrint(0, 1, "Touch pin error");
+        }
+        bootReadyTime = millis();
+        bootStage = BOOT_REPORT;
+    }
+    else if (bootStage == BOOT_REPORT)
+    {
+        // 부팅 시간 보고 (송신 버퍼가 모자라면 다음 틱에 다시)
+        uint8_t payload[4];
+        payload[0] = inputReadyTime & 0xFF;
+        payload[1] = (inputReadyTime >> 8) & 0xFF;
+        payload[2] = bootReadyTime & 0xFF;
+        payload[3] = (bootReadyTime >> 8) & 0xFF;
+        if (!commandProtocol.sendFrame(CMD_BOOT_REPORT, payload, sizeof(payload)))
+        {
+            return;
+        }
+
+#if SONEEBOT_MEMORY_DIAGNOSTICS
+        // 모듈은 모두 정적 할당이므로 여기서의 여유 SRAM이 곧 실제 여유 공간
+        memoryDiagnostics.requestReport();
+#endif
+
+#if COMMAND_TRANSPORT != COMMAND_TRANSPORT_HARDWARE
+        // 명령 링크가 따로 있으면 USB 시리얼에는 읽을 수 있는 글자로도
+        Serial.print(F("Boot input:"));
+        Serial.print(inputReadyTime);
+        Serial.print(F("ms ready:"));
+        Serial.print(bootReadyTime);
+        Serial.println(F("ms"));
+#if SONEEBOT_MEMORY_DIAGNOSTICS
+        memoryDiagnostics.report(Serial);
+#endif
+#endif
+        bootStage = BOOT_SCREEN;
+    }
+    else if (bootStage == BOOT_SCREEN)
+    {
+        // 그 전에 터치하면 미션 표시가 무지개를 멈추고 먼저 그림
+        if (displayManager.isBootEffectRunning())
+        {
+            return;
+        }
 
-    delay(2000);
+        // 시작 화면을 미션 화면으로 바꿈 (저장된 상태가 없어도, 센서 오류면 오류 표시 유지)
+        if (hasAllSensors())
+        {
+            uint8_t active = missionManager.getActiveMission();
+            eventBus.post(EVENT_MISSION_CHANGED, active, MISSION_SELECTED, missionManager.getRemaining(active));
+        }
+        bootStage = BOOT_DONE;
+    }
 }
 
 void SoneeBot::update(unsigned long currentMillis)
 {
     _currentMillis = currentMillis;
 
-    // 모든 터치 센서 업데이트
-    touch1->update(currentMillis);
-    touch2->update(currentMillis);
-    touch3->update(currentMillis);
+    // 모든 터치 센서 업데이트 (포트 스냅샷 한 번) -> 제스처 이벤트 발행
+    touchBank.update(currentMillis, readTouchPins());
+    gestures.update(&touchBank, currentMillis);
 
-    // 터치 상태 업데이트
-    updateTouchStates();
+    // 시작 단계 진행 (LCD는 이벤트 처리 전에 준비됨)
+    if (bootStage != BOOT_DONE)
+    {
+        updateBoot(currentMillis);
+    }
+
+    // 원격 명령 수신 및 처리 (틱당 처리 바이트 수 제한)
+    commandProtocol.update(this, &SoneeBot::handleCommand);
 
     // 서보 애니메이션 업데이트
-    servoAsync->update(currentMillis);
+    servoAsync.update(currentMillis);
 
     // 부저 업데이트
-    buzzerManager->update(currentMillis);
+    buzzerManager.update(currentMillis);
+
+    // 디스플레이 업데이트
+    displayManager.update(currentMillis);
+
+    // 미션 초기화 주기 확인 (1분마다)
+    missionManager.update(currentMillis);
 
-    // 메시지 및 상태 업데이트
+    // 미션 상태 저널, 상호작용 기록 (틱당 EEPROM 1바이트)
+    missionJournal.update(currentMillis, &eepromWriter);
+#if SONEEBOT_INTERACTION_LOG
+    interactionLog.update(&eepromWriter);
+#endif
+    eepromWriter.update();
+
+#if SONEEBOT_MEMORY_DIAGNOSTICS
+    // 힙 최고점 추적
+    memoryDiagnostics.update(currentMillis);
+#endif
+
+    // 이번 틱에 발생한 이벤트에만 반응
+    eventBus.dispatch(this, eventRoutes, sizeof(eventRoutes) / sizeof(eventRoutes[0]));
+
+#if SONEEBOT_SERVO_STREAM
+    // 서보 스트림 크레딧 반환 (소비했거나 상태가 바뀌었을 때)
+    if (servoStream.isCreditPending())
+    {
+        sendStreamCredit();
+    }
+#endif
+
+#if SONEEBOT_INTERACTION_LOG
+    // 상호작용 기록 내보내기 (틱당 한 프레임)
+    interactionLog.updateExport(currentMillis, &commandProtocol);
+#endif
+
+#if SONEEBOT_TELEMETRY
+    // 상태 텔레메트리 (설정된 주기마다, 바뀐 항목만)
+    if (telemetry.isDue(currentMillis))
+    {
+        sendTelemetry(currentMillis);
+    }
+#endif
+
+#if SONEEBOT_MEMORY_DIAGNOSTICS
+    // 메모리 보고 (요청 시, 설정된 주기마다)
+    if (memoryDiagnostics.isReportDue(currentMillis))
+    {
+        memoryDiagnostics.sendReport(currentMillis, &commandProtocol);
+    }
+#endif
+
+    // 이번 틱의 픽셀 변경을 한 번에 출력
+    // show()는 인터럽트를 막으므로 서보 펄스 구간과 부저 음 출력 중에는 피함
+    displayManager.commit(currentMillis,
+                          servoController.isPulseWindowIdle(displayManager.getShowDurationUs()),
+                          buzzerManager.isToneSounding());
+
+    // 무입력 절전 (백라이트 끔 -> LED/서보 끄고 전원 차단)
+    if (idleManager.update(currentMillis, isBusy()))
+    {
+        if (idleManager.getState() == IDLE_DIMMED)
+        {
+            displayManager.lcdBacklightOff();
+        }
+        else if (idleManager.getState() == IDLE_SLEEPING)
+        {
+            enterSleep();
+        }
+    }
+    else if (idleManager.getState() == IDLE_DIMMED)
+    {
+        idleManager.idleCpu();
+    }
+}
+
+bool SoneeBot::hasAllSensors()
+{
+    return touch1 != TouchBank::NO_SENSOR && touch2 != TouchBank::NO_SENSOR && touch3 != TouchBank::NO_SENSOR;
+}
+
+uint8_t SoneeBot::readTouchPins()
+{
+    // 포트를 틱마다 한 번만 읽어 센서끼리 다른 시점 값이 섞이지 않게 함
+    PortSnapshot ports;
+    ports.read();
+    return touchBank.readState(ports);
+}
+
+void SoneeBot::logInteraction(uint8_t type, uint8_t sensor)
+{
+#if SONEEBOT_INTERACTION_LOG
+    interactionLog.log(type, sensor, _currentMillis);
+#endif
+}
+
+bool SoneeBot::isBusy()
+{
+    // 진행 중인 동작이 있거나 호스트가 보고 있으면 절전하지 않음
+    return touchBank.getHeldMask() != 0 ||
+           buzzerManager.getIsPlaying() ||
+           servoAsync.isAnimationRunning() ||
+           displayManager.isShowingGoodJob() ||
+           displayManager.isMissionCompleteEffectRunning() ||
+           eepromWriter.isBusy() ||
+#if SONEEBOT_INTERACTION_LOG
+           interactionLog.hasPending() ||
+           interactionLog.isExporting() ||
+#endif
+#if SONEEBOT_TELEMETRY
+           telemetry.getInterval() != 0 ||
+#endif
+           commandProtocol.getTxPending() > 0;
+}
+
+void SoneeBot::wake()
+{
+    if (idleManager.activity(_currentMillis))
+    {
+        displayManager.lcdBacklightOn();
+    }
+}
+
+void SoneeBot::enterSleep()
+{
+    // 저장할 상태는 먼저 씀
+    missionJournal.flush(&eepromWriter);
+
+    displayManager.clearPixels();
+    displayManager.commit();
+    displayManager.lcdBacklightOff();
+    servoController.detach();
+    Serial.flush();
+
+    idleManager.sleepUntilWake();
+
+    // 깨어남: 서보 다시 연결, 화면 복구
+    _currentMillis = millis();
+    servoController.init();
+    idleManager.activity(_currentMillis);
+    displayManager.lcdBacklightOn();
+    displayManager.invalidateMissionDisplay();
     updateMessage();
+}
 
-    // 디스플레이 업데이트
-    displayManager->update(currentMillis);
+void SoneeBot::restoreMissionState()
+{
+    uint8_t state[MissionJournal::PAYLOAD_SIZE];
+    if (!missionJournal.recover(state))
+    {
+        return; // 저장된 상태 없음 (처음 부팅)
+    }
+
+    // 미션 화면은 시작 단계가 끝날 때 표시 (updateBoot)
+    missionManager.load(state);
+}
 
-    // 미션 매니저 업데이트
-    missionManager->update(missionCount, lastMissionCount);
+void SoneeBot::saveMissionState()
+{
+    uint8_t state[MissionJournal::PAYLOAD_SIZE] = {0};
+    missionManager.save(state);
+
+    missionJournal.record(state, _currentMillis);
 }
 
-void SoneeBot::updateTouchStates()
+void SoneeBot::onTouch(const Event &event)
 {
-    // Touch 1 처리 (미션 감소용)
-    if (touch1->isPressed())
+    uint8_t sensor = event.arg1;
+    wake();
+
+    // 진단 화면을 닫은 터치는 다음에 누를 때까지 아무 동작도 하지 않음 (뗄 때의 탭 포함)
+    if (event.arg0 == GESTURE_PRESS)
     {
-        displayManager->showGoodJobMessage(_currentMillis);
+        uint8_t bit = 1 << sensor;
+        ignoredTouchMask &= ~bit;
+        if (diagnosticsShown)
+        {
+            diagnosticsShown = false;
+            ignoredTouchMask |= bit;
+            updateMessage();
+            return;
+        }
+    }
+    else if (event.arg0 != GESTURE_CHORD && (ignoredTouchMask & (1 << sensor)))
+    {
+        // 눌림 표시(-ing/+ing)는 지워야 하므로 뗄 때 화면만 갱신
+        if (event.arg0 == GESTURE_RELEASE)
+        {
+            updateMessage();
+        }
+        return;
     }
 
-    if (touch1->isHeld())
+    switch (event.arg0)
     {
-        int expectedBeepCount = (touch1->getDuration() / 500) + 1;
-        int currentBeepCount = touch1->getBeepCount();
+    case GESTURE_PRESS:
+        logInteraction(LOG_TOUCH, sensor);
+        if (sensor == touch1)
+        {
+            displayManager.showGoodJobMessage(_currentMillis);
+        }
+        // 눌림 상태 표시 (+ing / -ing) 갱신
+        updateMessage();
+        break;
+
+    case GESTURE_RELEASE:
+        updateMessage();
+        break;
+
+    case GESTURE_REPEAT:
+        if (sensor == touch1) // 미션 감소
+        {
+            uint8_t active = missionManager.getActiveMission();
+            servoAsync.startMissionDecraseMotion(_currentMillis);
+            buzzerManager.playSuccess();
+
+            missionManager.addProgress(active);
+            displayManager.updateMissionPixels(missionManager.getRemaining(active));
+        }
+        else if (sensor == touch2) // 미션 증가
+        {
+            buzzerManager.addNote(1200, 200);
+            buzzerManager.addNote(0, 50);
+            buzzerManager.addNote(1200, 200);
+            missionManager.addGoal(missionManager.getActiveMission());
+        }
+        break;
 
-        if (expectedBeepCount > currentBeepCount)
+    case GESTURE_TAP:
+        // 롱프레스(미션 전환)와 겹치지 않도록 뗄 때 동작
+        if (sensor == touch3) // 랜덤 서보 선택
         {
-            servoAsync->startMissionDecraseMotion(_currentMillis);
-            buzzerManager->playSuccess();
+            int selectedServo = random(1, 3);
+            servoAsync.startRandomMotion(selectedServo, _currentMillis);
+            buzzerManager.playRandom();
+        }
+        break;
 
-            touch1->incrementBeepCount();
-            missionCount--;
-            if (missionCount < 0)
+    case GESTURE_CHORD:
+        for (uint8_t i = 0; i < sizeof(touchChords); i++)
+        {
+            if (event.value == touchChords[i])
             {
-                missionCount = 0;
+                logInteraction(LOG_CHORD, i);
             }
-            displayManager->updateMissionPixels(missionCount);
         }
+        break;
+
+    case GESTURE_LONG_PRESS:
+        if (sensor == touch3) // 표시할 미션 전환
+        {
+            missionManager.selectNext();
+        }
+        break;
+
+    default:
+        // 더블탭은 아직 반응 없음
+        break;
     }
+}
 
-    if (touch1->isReleased())
+void SoneeBot::onMissionChanged(const Event &event)
+{
+    if (event.arg1 == MISSION_GOAL_UP)
     {
-        touch1->addToLastBeepCount();
+        logInteraction(LOG_MISSION_UP, event.arg0);
+    }
+    else if (event.arg1 == MISSION_PROGRESS)
+    {
+        logInteraction(LOG_MISSION_DOWN, event.arg0);
     }
 
-    // Touch 2 처리 (미션 증가용)
-    if (touch2->isHeld())
+    if (event.arg1 != MISSION_SELECTED)
     {
-        int expectedBeepCount = (touch2->getDuration() / 500) + 1;
-        int currentBeepCount = touch2->getBeepCount();
+        saveMissionState();
+    }
+    updateMessage();
+}
 
-        if (expectedBeepCount > currentBeepCount)
-        {
-            buzzerManager->addNote(1200, 200);
-            buzzerManager->addNote(0, 50);
-            buzzerManager->addNote(1200, 200);
-            touch2->incrementBeepCount();
-            missionCount++;
-        }
+void SoneeBot::onMissionCompleted(const Event &event)
+{
+    logInteraction(LOG_MISSION_COMPLETE, event.arg0);
+
+    // Good Job 메시지가 끝난 뒤 축하 효과 (updateMessage에서 시작)
+    celebrationPending = true;
+    updateMessage();
+}
+
+void SoneeBot::onAnimationFinished(const Event &event)
+{
+    // 디스플레이 효과가 끝나면 미션 화면 복귀
+    if (event.arg0 != ANIMATION_SERVO)
+    {
+        updateMessage();
     }
+}
+
+void SoneeBot::handleCommand(const Command &command)
+{
+    wake();
+    uint8_t status = executeCommand(command);
 
-    if (touch2->isReleased())
+    // 스트림 설정점은 크레딧 보고가 응답을 대신함
+    if (command.opcode != CMD_STREAM_POINTS || status != CMD_STATUS_OK)
     {
-        touch2->addToLastBeepCount();
+        commandProtocol.sendAck(command.opcode, status);
     }
+}
+
+uint8_t SoneeBot::executeCommand(const Command &command)
+{
+    const uint8_t *data = command.payload;
 
-    // Touch 3 처리 (랜덤 서보 선택)
-    if (touch3->isHeld())
+    switch (command.opcode)
     {
-        int expectedBeepCount = (touch3->getDuration() / 500) + 1;
-        int currentBeepCount = touch3->getBeepCount();
+    case CMD_PING:
+        return CMD_STATUS_OK;
 
-        if (expectedBeepCount > currentBeepCount)
+    case CMD_SERVO_TARGET:
+        if (command.length != 2 || data[1] > 180)
+            return CMD_STATUS_BAD_ARGUMENT;
+        if (data[0] == 0 || data[0] == 1)
         {
-            int selectedServo = random(1, 3);
-            servoAsync->startRandomMotion(selectedServo, _currentMillis);
-            buzzerManager->playRandom();
-            touch3->incrementBeepCount();
+            servoController.moveServo1(data[1]);
         }
+        if (data[0] == 0 || data[0] == 2)
+        {
+            servoController.moveServo2(data[1]);
+        }
+        return CMD_STATUS_OK;
+
+    case CMD_MELODY:
+        if (command.length != 1)
+            return CMD_STATUS_BAD_ARGUMENT;
+        if (data[0] == 0xFF)
+        {
+            buzzerManager.stop();
+            return CMD_STATUS_OK;
+        }
+        return buzzerManager.playMelody(data[0]) ? CMD_STATUS_OK : CMD_STATUS_BAD_ARGUMENT;
+
+    case CMD_LED_FRAME:
+        if (command.length < 4 || (command.length - 1) % 3 != 0)
+            return CMD_STATUS_BAD_ARGUMENT;
+        for (uint8_t i = 1; i + 2 < command.length; i += 3)
+        {
+            displayManager.setPixelColor(data[0] + i / 3, data[i], data[i + 1], data[i + 2]);
+        }
+        return CMD_STATUS_OK;
+
+    case CMD_LCD_TEXT:
+    {
+        if (command.length < 2 || data[0] > 1 || data[1] > 15)
+            return CMD_STATUS_BAD_ARGUMENT;
+        // 수신 버퍼 안에서 바로 문자열로 사용
+        command.payload[command.length] = '\0';
+        displayManager.lcdPrint(data[1], data[0], (const char *)data + 2);
+        return CMD_STATUS_OK;
     }
 
-    if (touch3->isReleased())
+#if SONEEBOT_TELEMETRY
+    case CMD_TELEMETRY_RATE:
+        if (command.length != 1)
+            return CMD_STATUS_BAD_ARGUMENT;
+        telemetry.setInterval(data[0] * 10);
+        return CMD_STATUS_OK;
+#endif
+
+#if SONEEBOT_SERVO_STREAM
+    case CMD_STREAM_START:
+        servoStream.begin();
+        servoAsync.startStream(&servoStream, _currentMillis);
+        return CMD_STATUS_OK;
+
+    case CMD_STREAM_POINTS:
+        if (command.length == 0 || command.length % 4 != 0 || servoStream.getState() == STREAM_IDLE)
+            return CMD_STATUS_BAD_ARGUMENT;
+        if (command.length / 4 > servoStream.getFree())
+            return CMD_STATUS_BUSY;
+        for (uint8_t i = 0; i < command.length; i += 4)
+        {
+            servoStream.push(data[i] | (data[i + 1] << 8), data[i + 2], data[i + 3]);
+        }
+        return CMD_STATUS_OK;
+
+    case CMD_STREAM_END:
+        if (command.length != 1 || data[0] > 1)
+            return CMD_STATUS_BAD_ARGUMENT;
+        if (data[0] == 0)
+        {
+            servoStream.end();
+        }
+        else
+        {
+            servoStream.reset();
+        }
+        return CMD_STATUS_OK;
+#endif
+
+#if SONEEBOT_INTERACTION_LOG
+    case CMD_LOG_EXPORT:
+        interactionLog.startExport();
+        return CMD_STATUS_OK;
+#endif
+
+#if SONEEBOT_MEMORY_DIAGNOSTICS
+    case CMD_DIAGNOSTICS:
+        if (command.length > 1)
+            return CMD_STATUS_BAD_ARGUMENT;
+        if (command.length == 1)
+        {
+            memoryDiagnostics.setReportInterval(data[0] * 1000UL);
+            return CMD_STATUS_OK;
+        }
+        // 미션 상태는 건드리지 않고 화면만 바꿈 (다음 터치에 닫힘)
+        memoryDiagnostics.showOnLcd(&displayManager);
+        displayManager.invalidateMissionDisplay();
+        diagnosticsShown = true;
+        memoryDiagnostics.requestReport();
+        return CMD_STATUS_OK;
+#endif
+
+    default:
+        return CMD_STATUS_UNKNOWN;
+    }
+}
+
+#if SONEEBOT_TELEMETRY
+void SoneeBot::sendTelemetry(unsigned long currentMillis)
+{
+    uint8_t sample[TELEMETRY_FIELD_COUNT];
+    sample[TELEMETRY_SERVO1] = servoController.getServo1Angle();
+    sample[TELEMETRY_SERVO2] = servoController.getServo2Angle();
+    sample[TELEMETRY_TOUCH] = touchBank.getHeldMask();
+    sample[TELEMETRY_MISSION] = missionManager.getRemaining(missionManager.getActiveMission());
+    sample[TELEMETRY_BUZZER_QUEUE] = buzzerManager.getQueueSize();
+
+    telemetry.send(currentMillis, sample, &commandProtocol);
+}
+#endif
+
+#if SONEEBOT_SERVO_STREAM
+void SoneeBot::sendStreamCredit()
+{
+    uint8_t payload[3];
+    payload[0] = servoStream.getConsumedCount();
+    payload[1] = servoStream.getFree();
+    payload[2] = servoStream.getState();
+
+    // 송신 버퍼가 가득 차면 다음 틱에 다시 보냄
+    if (commandProtocol.sendFrame(CMD_STREAM_CREDIT, payload, sizeof(payload)))
     {
-        touch3->addToLastBeepCount();
+        servoStream.clearCreditPending();
     }
 }
+#endif
 
 void SoneeBot::updateMessage()
 {
+    // 진단 화면은 다음 터치까지 유지
+    if (diagnosticsShown)
+    {
+        return;
+    }
+
     // 미션 완료 효과가 실행 중이면 리턴
-    if (displayManager->isMissionCompleteEffectRunning())
+    if (displayManager.isMissionCompleteEffectRunning())
     {
         return;
     }
 
     // Good Job 메시지 표시 중이면 리턴
-    if (displayManager->isShowingGoodJob())
+    if (displayManager.isShowingGoodJob())
     {
         return;
     }
 
-    // 미션 완료 체크
-    if (missionManager->isMissionCompleted())
+    // 미션 완료 축하
+    if (celebrationPending)
     {
-        displayManager->startMissionCompleteEffect(_currentMillis);
-        servoAsync->startMissionCompleteAnimation(_currentMillis);
+        displayManager.startMissionCompleteEffect(_currentMillis);
+        servoAsync.startMissionCompleteAnimation(_currentMillis);
 
-        buzzerManager->playHappyBirthday();
+        buzzerManager.playHappyBirthday();
 
-        missionCount = 0;
-        missionManager->resetMissionCompleted();
+        celebrationPending = false;
         return;
     }
 
     // 미션 디스플레이 업데이트
-    displayManager->updateMissionDisplay(missionCount, touch1->isHeld(), touch2->isHeld());
+    uint8_t active = missionManager.getActiveMission();
+    displayManager.updateMissionDisplay(active, missionManager.getRemaining(active),
+                                        touchBank.isHeld(touch1), touchBank.isHeld(touch2));
 }
 
 void SoneeBot::testAllDevices()
 {
-    displayManager->lcdPrint(0, 0, "Testing All");
-    displayManager->lcdPrint(0, 1, "Devices...");
+    displayManager.lcdPrint(0, 0, "Testing All");
+    displayManager.lcdPrint(0, 1, "Devices...");
 
     // 서보 테스트
-    servoController->moveServo1(0);
-    servoController->moveServo2(180);
+    servoController.moveServo1(0);
+    servoController.moveServo2(180);
     delay(500);
-    servoController->moveServo1(180);
-    servoController->moveServo2(0);
+    servoController.moveServo1(180);
+    servoController.moveServo2(0);
     delay(500);
-    servoController->resetToDefault();
+    servoController.resetToDefault();
 
     // 네오픽셀 테스트
-    displayManager->fillColor(255, 0, 0);
+    displayManager.fillColor(255, 0, 0);
+    displayManager.commit();
     delay(300);
-    displayManager->fillColor(0, 255, 0);
+    displayManager.fillColor(0, 255, 0);
+    displayManager.commit();
     delay(300);
-    displayManager->fillColor(0, 0, 255);
+    displayManager.fillColor(0, 0, 255);
+    displayManager.commit();
     delay(300);
-    displayManager->clearPixels();
+    displayManager.clearPixels();
+    displayManager.commit();
 
     // 비동기 부저 테스트
-    buzzerManager->addNote(1000, 100);
-    buzzerManager->addNote(0, 50);
-    buzzerManager->addNote(1000, 100);
-    buzzerManager->addNote(0, 50);
-    buzzerManager->addNote(1000, 100);
+    buzzerManager.addNote(1000, 100);
+    buzzerManager.addNote(0, 50);
+    buzzerManager.addNote(1000, 100);
+    buzzerManager.addNote(0, 50);
+    buzzerManager.addNote(1000, 100);
 }
@@ -1,51 +1,135 @@
 #ifndef SONEEBOT_HPP
 #define SONEEBOT_HPP
 
+#include "CommandProtocol.hpp"
 #include "DisplayManager.hpp"
+#include "EepromWriter.hpp"
+#include "EventBus.hpp"
+#include "FastPin.hpp"
+#include "GestureRecognizer.hpp"
+#include "IdleManager.hpp"
+#include "InteractionLog.hpp"
+#include "MemoryDiagnostics.hpp"
+#include "MissionJournal.hpp"
 #include "MissionManager.hpp"
 #include "PassiveBuzzerManager.hpp"
 #include "ServoAsync.hpp"
 #include "ServoController.hpp"
-#include "TouchSensor.hpp"
+#include "ServoStream.hpp"
+#include "SoneeBotConfig.hpp"
+#include "Telemetry.hpp"
+#include "TouchBank.hpp"
 #include <Arduino.h>
 
 class SoneeBot
 {
 private:
-    // 모듈들
-    TouchSensor *touch1;
-    TouchSensor *touch2;
-    TouchSensor *touch3;
-    ServoController *servoController;
-    ServoAsync *servoAsync;
-    DisplayManager *displayManager;
-    MissionManager *missionManager;
-    PassiveBuzzerManager *buzzerManager;
-    int missionCount;
-    int lastMissionCount;
+    // 모듈들 (정적 할당 - 선언 순서대로 생성됨)
+    EventBus eventBus;
+    TouchBank touchBank;
+    GestureRecognizer gestures;
+    uint8_t touch1; // 미션 감소
+    uint8_t touch2; // 미션 증가
+    uint8_t touch3; // 랜덤 서보
+    ServoController servoController;
+    ServoAsync servoAsync;
+#if SONEEBOT_SERVO_STREAM
+    ServoStream servoStream;
+#endif
+    DisplayManager displayManager;
+    MissionManager missionManager;
+    EepromWriter eepromWriter;
+    MissionJournal missionJournal;
+#if SONEEBOT_INTERACTION_LOG
+    InteractionLog interactionLog;
+#endif
+    IdleManager idleManager;
+    PassiveBuzzerManager buzzerManager;
+#if SONEEBOT_MEMORY_DIAGNOSTICS
+    MemoryDiagnostics memoryDiagnostics;
+#endif
+    CommandProtocol commandProtocol;
+#if SONEEBOT_TELEMETRY
+    Telemetry telemetry;
+#endif
+    bool celebrationPending; // 미션 완료 후 축하 효과 대기
+    bool diagnosticsShown;    // 메모리 진단 화면 표시 중 (다음 터치에 닫힘)
+    uint8_t ignoredTouchMask; // 진단 화면을 닫은 센서 (뗄 때까지 무시)
+
+    // 시작 단계 (update에서 진행)
+    enum BootStage
+    {
+        BOOT_LCD,    // 첫 틱: 터치 입력 후 LCD 초기화
+        BOOT_REPORT, // 부팅 시간, 메모리 보고
+        BOOT_SCREEN, // 초기화 무지개가 끝나면 미션 화면
+        BOOT_DONE
+    };
+    uint8_t bootStage;
+    unsigned long inputReadyTime; // 첫 터치 샘플 시각 (리셋 후 ms)
+    unsigned long bootReadyTime;  // LCD까지 준비된 시각
+
+    // 이벤트 타입 -> 핸들러 정적 디스패치 테이블
+    static const EventRoute<SoneeBot> eventRoutes[];
+
+    void restoreMissionState();
+    bool hasAllSensors();
+    uint8_t readTouchPins();
+    void logInteraction(uint8_t type, uint8_t sensor);
+    void updateBoot(unsigned long currentMillis);
+    bool isBusy();
+    void wake();
+    void enterSleep();
+    void saveMissionState();
+    uint8_t executeCommand(const Command &command);
+#if SONEEBOT_TELEMETRY
+    void sendTelemetry(unsigned long currentMillis);
+#endif
+#if SONEEBOT_SERVO_STREAM
+    void sendStreamCredit();
+#endif
 
 public:
-    SoneeBot(int s1Pin = 10, int s2Pin = 11, int neoPin = 3, int neoCount = 4,
-             int t1Pin = 8, int t2Pin = 7, int t3Pin = 4, int buzPin = 2);
-    ~SoneeBot();
+    // 핀과 기능은 SoneeBotConfig.hpp에서 컴파일 시점에 정함
+    SoneeBot();
 
     void init();
-    void updateTouchStates();
     void updateMessage();
     void update(unsigned long currentMillis);
     unsigned long _currentMillis;
 
+    // 이벤트 핸들러들
+    void onTouch(const Event &event);
+    void onMissionChanged(const Event &event);
+    void onMissionCompleted(const Event &event);
+    void onAnimationFinished(const Event &event);
+    void handleCommand(const Command &command);
+
     // 테스트 함수들
     void testAllDevices();
 
     // 접근자 함수들
-    TouchSensor *getTouch1() { return touch1; }
-    TouchSensor *getTouch2() { return touch2; }
-    TouchSensor *getTouch3() { return touch3; }
-    ServoController *getServoController() { return servoController; }
-    DisplayManager *getDisplayManager() { return displayManager; }
-    MissionManager *getMissionManager() { return missionManager; }
-    PassiveBuzzerManager *getBuzzerManager() { return buzzerManager; }
+    EventBus *getEventBus() { return &eventBus; }
+    TouchBank *getTouchBank() { return &touchBank; }
+    GestureRecognizer *getGestureRecognizer() { return &gestures; }
+    ServoController *getServoController() { return &servoController; }
+#if SONEEBOT_SERVO_STREAM
+    ServoStream *getServoStream() { return &servoStream; }
+#endif
+    DisplayManager *getDisplayManager() { return &displayManager; }
+    MissionManager *getMissionManager() { return &missionManager; }
+    MissionJournal *getMissionJournal() { return &missionJournal; }
+#if SONEEBOT_INTERACTION_LOG
+    InteractionLog *getInteractionLog() { return &interactionLog; }
+#endif
+    IdleManager *getIdleManager() { return &idleManager; }
+    PassiveBuzzerManager *getBuzzerManager() { return &buzzerManager; }
+#if SONEEBOT_MEMORY_DIAGNOSTICS
+    MemoryDiagnostics *getMemoryDiagnostics() { return &memoryDiagnostics; }
+#endif
+    CommandProtocol *getCommandProtocol() { return &commandProtocol; }
+#if SONEEBOT_TELEMETRY
+    Telemetry *getTelemetry() { return &telemetry; }
+#endif
 };
 
 #endif
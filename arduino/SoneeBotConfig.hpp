@@ -0,0 +1,74 @@
+#ifndef SONEEBOTCONFIG_HPP
+#define SONEEBOTCONFIG_HPP
+
+#include <Arduino.h>
+
+// 핀 배치와 기능 선택 (컴파일 시점)
+// 배선이 다르거나 기능을 빼려면 이 파일을 고치거나 빌드 플래그로 덮어씀 (-DSONEEBOT_TELEMETRY=0)
+// 꺼진 기능은 멤버와 코드가 #if로 빠지므로 플래시와 SRAM을 쓰지 않음
+
+// ===== 핀 =====
+#ifndef SONEEBOT_SERVO1_PIN
+#define SONEEBOT_SERVO1_PIN 10
+#endif
+#ifndef SONEEBOT_SERVO2_PIN
+#define SONEEBOT_SERVO2_PIN 11
+#endif
+#ifndef SONEEBOT_NEOPIXEL_PIN
+#define SONEEBOT_NEOPIXEL_PIN 3
+#endif
+#ifndef SONEEBOT_NEOPIXEL_COUNT
+#define SONEEBOT_NEOPIXEL_COUNT 4
+#endif
+#ifndef SONEEBOT_MISSIONS_PER_TIER
+#define SONEEBOT_MISSIONS_PER_TIER 3 // 스트립 전체를 한 색 단계로 채우는 미션 수 (스트립 길이와 별개)
+#endif
+#ifndef SONEEBOT_TOUCH1_PIN
+#define SONEEBOT_TOUCH1_PIN 8 // 미션 감소
+#endif
+#ifndef SONEEBOT_TOUCH2_PIN
+#define SONEEBOT_TOUCH2_PIN 7 // 미션 증가
+#endif
+#ifndef SONEEBOT_TOUCH3_PIN
+#define SONEEBOT_TOUCH3_PIN 4 // 랜덤 서보
+#endif
+#ifndef SONEEBOT_BUZZER_PIN
+#define SONEEBOT_BUZZER_PIN 2
+#endif
+
+// ===== 기능 (1 = 사용) =====
+#ifndef SONEEBOT_TELEMETRY
+#define SONEEBOT_TELEMETRY 1 // 상태 텔레메트리 (CMD_TELEMETRY_RATE)
+#endif
+#ifndef SONEEBOT_SERVO_STREAM
+#define SONEEBOT_SERVO_STREAM 1 // 호스트 서보 궤적 스트림 (CMD_STREAM_*)
+#endif
+#ifndef SONEEBOT_INTERACTION_LOG
+#define SONEEBOT_INTERACTION_LOG 1 // EEPROM 상호작용 기록 (CMD_LOG_EXPORT)
+#endif
+#ifndef SONEEBOT_MEMORY_DIAGNOSTICS
+#define SONEEBOT_MEMORY_DIAGNOSTICS 1 // SRAM 보고, CMD_DIAGNOSTICS(0x0A)로 LCD 표시
+#endif
+#ifndef SONEEBOT_STATUS_DISPLAY
+#define SONEEBOT_STATUS_DISPLAY 0 // DisplayManager::updateStatusDisplay (서보 각도/터치 시간 화면)
+#endif
+
+// 타입이 있는 이름으로 쓰기 위한 상수 묶음 (템플릿 인자로도 사용)
+struct SoneeBotConfig
+{
+    static constexpr uint8_t servo1Pin = SONEEBOT_SERVO1_PIN;
+    static constexpr uint8_t servo2Pin = SONEEBOT_SERVO2_PIN;
+    static constexpr uint8_t neoPixelPin = SONEEBOT_NEOPIXEL_PIN;
+    static constexpr uint8_t neoPixelCount = SONEEBOT_NEOPIXEL_COUNT;
+    static constexpr uint16_t missionsPerTier = SONEEBOT_MISSIONS_PER_TIER;
+    static constexpr uint8_t touch1Pin = SONEEBOT_TOUCH1_PIN;
+    static constexpr uint8_t touch2Pin = SONEEBOT_TOUCH2_PIN;
+    static constexpr uint8_t touch3Pin = SONEEBOT_TOUCH3_PIN;
+    static constexpr uint8_t buzzerPin = SONEEBOT_BUZZER_PIN;
+
+    // 터치 센서 등록 순서 (touch1, touch2, touch3 = 센서 번호 0, 1, 2)
+    static constexpr uint8_t touchCount = 3;
+    static constexpr uint8_t touchPins[touchCount] = {touch1Pin, touch2Pin, touch3Pin};
+};
+
+#endif
@@ -0,0 +1,58 @@
+#include "Telemetry.hpp"
+
+Telemetry::Telemetry(uint16_t intervalMs)
+{
+    this->intervalMs = intervalMs;
+    sequence = 0;
+    periodsSinceKeyframe = KEYFRAME_EVERY; // 첫 프레임은 전체 항목
+    memset(lastSent, 0, sizeof(lastSent));
+}
+
+void Telemetry::setInterval(uint16_t intervalMs)
+{
+    this->intervalMs = intervalMs;
+    periodsSinceKeyframe = KEYFRAME_EVERY;
+}
+
+bool Telemetry::isDue(unsigned long currentMillis)
+{
+    return intervalMs != 0 && sendTimer.hasElapsed(currentMillis, intervalMs);
+}
+
+void Telemetry::send(unsigned long currentMillis, const uint8_t *sample, CommandProtocol *protocol)
+{
+    bool keyframe = periodsSinceKeyframe >= KEYFRAME_EVERY;
+    uint8_t payload[2 + TELEMETRY_FIELD_COUNT];
+    uint8_t length = 2;
+    uint8_t mask = 0;
+
+    for (uint8_t i = 0; i < TELEMETRY_FIELD_COUNT; i++)
+    {
+        if (keyframe || sample[i] != lastSent[i])
+        {
+            mask |= 1 << i;
+            payload[length++] = sample[i];
+        }
+    }
+
+    // 바뀐 것이 없으면 보내지 않고 주기만 셈
+    if (mask == 0)
+    {
+        sendTimer.start(currentMillis);
+        periodsSinceKeyframe++;
+        return;
+    }
+
+    payload[0] = sequence;
+    payload[1] = mask;
+
+    if (!protocol->sendFrame(CMD_TELEMETRY, payload, length))
+    {
+        return; // 타이머와 lastSent를 그대로 두어 다음 틱에 다시 보냄
+    }
+
+    sendTimer.start(currentMillis);
+    memcpy(lastSent, sample, sizeof(lastSent));
+    sequence++;
+    periodsSinceKeyframe = keyframe ? 1 : periodsSinceKeyframe + 1;
+}
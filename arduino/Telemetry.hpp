@@ -0,0 +1,48 @@
+#ifndef TELEMETRY_HPP
+#define TELEMETRY_HPP
+
+#include "CommandProtocol.hpp"
+#include "Timer.hpp"
+#include <Arduino.h>
+
+// 텔레메트리 항목 (프레임의 변경 비트 순서)
+enum TelemetryField
+{
+    TELEMETRY_SERVO1,       // 서보1 각도
+    TELEMETRY_SERVO2,       // 서보2 각도
+    TELEMETRY_TOUCH,        // 터치 눌림 비트마스크
+    TELEMETRY_MISSION,      // 미션 수 (255로 제한)
+    TELEMETRY_BUZZER_QUEUE, // 부저 큐 길이
+    TELEMETRY_FIELD_COUNT
+};
+
+// 로봇 상태를 주기적으로 보내는 이진 텔레메트리
+// 페이로드: [순번][변경 비트마스크][바뀐 항목 값...]
+// 바뀐 항목만 보내고, KEYFRAME_EVERY 주기마다 전체 항목을 보냄 (수신측 재동기화)
+// 바뀐 것이 없어 보내지 않은 주기도 세므로 늦게 연결한 수신측도 KEYFRAME_EVERY 주기 안에 동기화됨
+class Telemetry
+{
+public:
+    static const uint8_t KEYFRAME_EVERY = 10;
+
+private:
+    uint8_t lastSent[TELEMETRY_FIELD_COUNT];
+    uint16_t intervalMs; // 0 = 끔
+    Timer sendTimer;
+    uint8_t sequence;
+    uint8_t periodsSinceKeyframe;
+
+public:
+    Telemetry(uint16_t intervalMs = 0);
+
+    void setInterval(uint16_t intervalMs);
+    uint16_t getInterval() { return intervalMs; }
+
+    // 보낼 시간이 되었으면 true (값 수집은 이때만)
+    bool isDue(unsigned long currentMillis);
+
+    // 바뀐 항목만 송신 버퍼에 넣음, 버퍼가 가득 차면 다음 틱에 다시 보냄
+    void send(unsigned long currentMillis, const uint8_t *sample, CommandProtocol *protocol);
+};
+
+#endif
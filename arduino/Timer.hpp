@@ -0,0 +1,28 @@
+#ifndef TIMER_HPP
+#define TIMER_HPP
+
+#include <Arduino.h>
+
+// 시작 시각부터의 경과 시간
+// millis()는 약 49.7일마다 0으로 돌아가지만 uint32_t 뺄셈은 그대로 맞음
+// unsigned long 끼리 직접 빼지 않는 이유: 호스트 시뮬레이터에서는 64비트라 순환 때 값이 튐
+// 0을 "꺼짐" 표시로 쓰지 말 것 - 순환 직후에는 0도 정상 시각
+class Timer
+{
+private:
+    uint32_t startTime;
+
+public:
+    Timer() : startTime(0) {}
+
+    void start(unsigned long currentMillis) { startTime = (uint32_t)currentMillis; }
+    void advance(uint32_t ms) { startTime += ms; } // 주기 기준점을 앞으로 (나머지 ms는 유지)
+
+    uint32_t elapsed(unsigned long currentMillis) const { return (uint32_t)currentMillis - startTime; }
+    bool hasElapsed(unsigned long currentMillis, uint32_t interval) const
+    {
+        return elapsed(currentMillis) >= interval;
+    }
+};
+
+#endif
@@ -0,0 +1,92 @@
+#include "TouchBank.hpp"
+
+TouchBank::TouchBank()
+{
+    sensorCount = 0;
+    currentMask = 0;
+    lastMask = 0;
+    lastMillis = 0;
+}
+
+uint8_t TouchBank::addSensor(int pin)
+{
+    if (sensorCount >= MAX_SENSORS)
+        return NO_SENSOR;
+
+    if (digitalPinToPort(pin) == NOT_A_PORT)
+        return NO_SENSOR;
+
+    pins[sensorCount] = pin;
+
+    return sensorCount++;
+}
+
+void TouchBank::init()
+{
+    for (uint8_t i = 0; i < sensorCount; i++)
+    {
+        pinMode(pins[i], INPUT);
+    }
+}
+
+uint8_t TouchBank::readState(const PortSnapshot &ports)
+{
+    uint8_t state = 0;
+    for (uint8_t i = 0; i < sensorCount; i++)
+    {
+        if (ports.isHigh(pins[i]))
+        {
+            state |= (1 << i);
+        }
+    }
+    return state;
+}
+
+void TouchBank::update(unsigned long currentMillis, uint8_t state)
+{
+    lastMask = currentMask;
+    currentMask = state;
+    lastMillis = currentMillis;
+
+    // 변화가 없으면 센서별 처리 생략
+    uint8_t changed = currentMask ^ lastMask;
+    if (!changed)
+        return;
+
+    for (uint8_t i = 0; i < sensorCount; i++)
+    {
+        if (changed & (1 << i))
+        {
+            // 터치 시작/해제 시각 기록
+            pressTimers[i].start(currentMillis);
+        }
+    }
+}
+
+bool TouchBank::isPressed(uint8_t id)
+{
+    if (id >= sensorCount)
+        return false;
+    return getPressedMask() & (1 << id);
+}
+
+bool TouchBank::isReleased(uint8_t id)
+{
+    if (id >= sensorCount)
+        return false;
+    return getReleasedMask() & (1 << id);
+}
+
+bool TouchBank::isHeld(uint8_t id)
+{
+    if (id >= sensorCount)
+        return false;
+    return currentMask & (1 << id);
+}
+
+unsigned long TouchBank::getDuration(uint8_t id)
+{
+    if (!isHeld(id))
+        return 0;
+    return pressTimers[id].elapsed(lastMillis);
+}
@@ -0,0 +1,52 @@
+#ifndef TOUCHBANK_HPP
+#define TOUCHBANK_HPP
+
+#include "FastPin.hpp"
+#include "Timer.hpp"
+#include <Arduino.h>
+
+// 여러 개의 터치 센서 상태를 한 번에 관리하는 클래스
+// - 핀은 호출 쪽이 틱마다 한 번 읽은 포트 스냅샷에서 등록 순서대로 비트마스크로 만듦 (readState)
+// - 센서 상태는 센서 번호를 비트 위치로 하는 비트마스크로 관리
+class TouchBank
+{
+public:
+    static const uint8_t MAX_SENSORS = 4;
+    static const uint8_t NO_SENSOR = 0xFF; // addSensor 실패
+
+private:
+    uint8_t pins[MAX_SENSORS];
+    uint8_t sensorCount;
+
+    // 비트마스크 상태 (bit i = 센서 i)
+    uint8_t currentMask;
+    uint8_t lastMask;
+
+    Timer pressTimers[MAX_SENSORS];
+    unsigned long lastMillis;
+
+public:
+    TouchBank();
+
+    // 센서 추가, 센서 번호 반환 (실패 시 NO_SENSOR)
+    uint8_t addSensor(int pin);
+    void init();
+    // 포트 스냅샷에서 등록한 핀 상태를 모음 (bit i = addSensor가 i를 돌려준 센서)
+    uint8_t readState(const PortSnapshot &ports);
+    void update(unsigned long currentMillis, uint8_t state);
+
+    // 전체 센서 비트마스크
+    uint8_t getHeldMask() { return currentMask; }
+    uint8_t getPressedMask() { return currentMask & ~lastMask; }
+    uint8_t getReleasedMask() { return ~currentMask & lastMask; }
+
+    // 개별 센서 상태
+    bool isPressed(uint8_t id);
+    bool isReleased(uint8_t id);
+    bool isHeld(uint8_t id);
+    unsigned long getDuration(uint8_t id);
+    uint8_t getSensorCount() { return sensorCount; }
+    uint8_t getPin(uint8_t id) { return pins[id]; }
+};
+
+#endif
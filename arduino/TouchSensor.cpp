@@ -5,7 +5,6 @@ TouchSensor::TouchSensor(int pinNumber)
     pin = pinNumber;
     currentState = false;
     lastState = false;
-    startTime = 0;
     duration = 0;
     beepCount = 0;
     lastBeepCount = 0;
@@ -26,10 +25,10 @@ void TouchSensor::update(unsigned long currentMillis)
     {
         if (!lastState)
         {
-            startTime = currentMillis;
+            pressTimer.start(currentMillis);
             beepCount = 0; // 터치 시작 시 beepCount 초기화
         }
-        duration = currentMillis - startTime;
+        duration = pressTimer.elapsed(currentMillis);
 
         // beepCount 자동 증가 로직 제거
         // SoneeBot에서 직접 관리하도록 변경
@@ -41,7 +40,6 @@ void TouchSensor::update(unsigned long currentMillis)
             lastBeepCount += beepCount;
         }
         duration = 0;
-        startTime = 0;
         beepCount = 0;
     }
 }
@@ -1,6 +1,7 @@
 #ifndef TOUCHSENSOR_HPP
 #define TOUCHSENSOR_HPP
 
+#include "Timer.hpp"
 #include <Arduino.h>
 
 class TouchSensor
@@ -9,7 +10,7 @@ private:
     int pin;
     bool currentState;
     bool lastState;
-    unsigned long startTime;
+    Timer pressTimer;
     unsigned long duration;
     int beepCount;
     int lastBeepCount;
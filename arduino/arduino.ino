@@ -1,6 +1,6 @@
 #include "SoneeBot.hpp"
 
-// SoneeBot 객체 생성 (기본 핀 설정 사용)
+// SoneeBot 객체 생성 (핀과 기능은 SoneeBotConfig.hpp에서 설정)
 SoneeBot robot;
 
 void setup()
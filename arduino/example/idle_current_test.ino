@@ -0,0 +1,97 @@
+#include "DisplayManager.hpp"
+#include "IdleManager.hpp"
+#include "ServoController.hpp"
+
+// ===== 절전 모드별 소비 전류 측정 =====
+// 배터리와 로봇 사이에 전류계를 연결하고 시리얼에 표시되는 모드별로 값을 읽음
+// 1) 정상 동작: 백라이트 켬, LED 켬, 서보 연결, loop 전속
+// 2) 백라이트 끔: LED 켬, 서보 연결, 틱 사이 SLEEP_MODE_IDLE
+// 3) 전원 차단: LED 끔, 서보 분리, SLEEP_MODE_PWR_DOWN (터치하면 1번으로)
+
+#define TOUCH1_PIN 8
+#define TOUCH2_PIN 7
+#define TOUCH3_PIN 4
+
+const unsigned long MODE_DURATION_MS = 30000;
+
+ServoController servos(10, 11);
+DisplayManager display(3, 4);
+IdleManager idle(0, 0); // 자동 전환 없음, 직접 단계를 바꿈
+
+uint8_t mode = 0;
+unsigned long modeStartTime = 0;
+
+void printMode(const __FlashStringHelper *name)
+{
+    Serial.print(F("Mode "));
+    Serial.print(mode + 1);
+    Serial.print(F(": "));
+    Serial.println(name);
+    Serial.flush();
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    servos.init();
+    display.init();
+    display.initLcd();
+
+    idle.addWakePin(TOUCH1_PIN);
+    idle.addWakePin(TOUCH2_PIN);
+    idle.addWakePin(TOUCH3_PIN);
+
+    display.fillColor(0, 40, 0);
+    display.commit();
+    printMode(F("active"));
+    modeStartTime = millis();
+}
+
+void loop()
+{
+    unsigned long now = millis();
+
+    if (mode == 1)
+    {
+        idle.idleCpu();
+    }
+
+    if (now - modeStartTime < MODE_DURATION_MS)
+    {
+        return;
+    }
+
+    mode = (mode + 1) % 3;
+    modeStartTime = now;
+
+    if (mode == 0)
+    {
+        printMode(F("active"));
+    }
+    else if (mode == 1)
+    {
+        display.lcdBacklightOff();
+        printMode(F("dimmed (idle sleep)"));
+    }
+    else
+    {
+        printMode(F("power-down, touch to wake"));
+        display.clearPixels();
+        display.commit();
+        servos.detach();
+
+        idle.sleepUntilWake();
+
+        Serial.print(F("Woke after "));
+        Serial.print(idle.getSleptMs());
+        Serial.println(F("ms (watchdog-counted)"));
+
+        servos.init();
+        display.lcdBacklightOn();
+        display.fillColor(0, 40, 0);
+        display.commit();
+        mode = 0;
+        modeStartTime = millis();
+        printMode(F("active"));
+    }
+}
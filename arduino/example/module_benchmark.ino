@@ -0,0 +1,258 @@
+#include "CommandProtocol.hpp"
+#include "DisplayManager.hpp"
+#include "EepromWriter.hpp"
+#include "EventBus.hpp"
+#include "GestureRecognizer.hpp"
+#include "PassiveBuzzerManager.hpp"
+#include "ServoAsync.hpp"
+#include "ServoController.hpp"
+#include "TouchBank.hpp"
+
+// ===== 모듈별 update() 비용 벤치마크 =====
+// 호스트 벤치(sim/ModuleBench.cpp)와 같은 상태를 타깃에서 micros()로 측정 (해상도 4us)
+// Servo가 Timer1을 쓰므로 touch_bank_benchmark처럼 사이클 카운터는 쓰지 않음
+// 터치 held 상태는 센서를 손으로 누른 채로 측정
+// 출력: 모듈, 상태, 평균 us, 최대 us (호출 1회)
+
+#define TOUCH1_PIN 8
+#define TOUCH2_PIN 7
+#define TOUCH3_PIN 4
+#define BUZZER_PIN 2
+#define NEOPIXEL_PIN 3
+#define NEOPIXEL_COUNT 4
+
+const int ITERATIONS = 200;
+
+const GestureConfig gestureConfigs[] = {{500, 1000, 300}, {500, 1000, 300}, {500, 1000, 300}};
+const uint8_t gestureChords[] = {0b011, 0b110};
+
+EventBus eventBus;
+TouchBank touchBank;
+GestureRecognizer gestures(&eventBus, gestureConfigs, gestureChords, sizeof(gestureChords));
+ServoController servoController(10, 11);
+ServoAsync servoAsync(&servoController, &eventBus);
+PassiveBuzzerManager buzzer(BUZZER_PIN);
+DisplayManager displayManager(NEOPIXEL_PIN, NEOPIXEL_COUNT, &eventBus);
+EepromWriter eepromWriter;
+CommandProtocol protocol;
+
+struct CommandSink
+{
+    void onCommand(const Command &command) {}
+};
+CommandSink sink;
+
+uint8_t eepromData[8];
+
+void drainEvents()
+{
+    Event event;
+    while (eventBus.poll(event))
+    {
+    }
+}
+
+// 측정 밖에서 호출 전 준비, 측정 대상 호출
+typedef void (*PrepareFunction)(int i);
+typedef void (*RunFunction)(unsigned long now);
+
+void noPrepare(int i) {}
+
+void runCase(const __FlashStringHelper *module, const __FlashStringHelper *state, PrepareFunction prepare,
+             RunFunction run)
+{
+    unsigned long total = 0;
+    unsigned long worst = 0;
+
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        drainEvents();
+        prepare(i);
+
+        unsigned long now = millis();
+        unsigned long start = micros();
+        run(now);
+        unsigned long elapsed = micros() - start;
+
+        total += elapsed;
+        if (elapsed > worst)
+            worst = elapsed;
+    }
+
+    Serial.print(module);
+    Serial.print('\t');
+    Serial.print(state);
+    Serial.print('\t');
+    Serial.print((float)total / ITERATIONS, 1);
+    Serial.print('\t');
+    Serial.println(worst);
+}
+
+// SoneeBot::readTouchPins와 같은 방식 (포트 스냅샷 한 번, 등록 순서대로 비트)
+uint8_t readTouchPins()
+{
+    PortSnapshot ports;
+    ports.read();
+    return touchBank.readState(ports);
+}
+
+void runTouchBank(unsigned long now)
+{
+    touchBank.update(now, readTouchPins());
+}
+
+void runGestures(unsigned long now)
+{
+    gestures.update(&touchBank, now);
+}
+
+void prepareGestures(int i)
+{
+    touchBank.update(millis(), readTouchPins());
+}
+
+void runServo(unsigned long now)
+{
+    servoAsync.update(now);
+}
+
+void prepareServoRandom(int i)
+{
+    if (!servoAsync.isAnimationRunning())
+        servoAsync.startRandomMotion(1, millis());
+}
+
+void prepareServoComplete(int i)
+{
+    if (!servoAsync.isAnimationRunning())
+        servoAsync.startMissionCompleteAnimation(millis());
+}
+
+void runBuzzer(unsigned long now)
+{
+    buzzer.update(now);
+}
+
+void prepareBuzzerMelody(int i)
+{
+    if (!buzzer.getIsPlaying())
+        buzzer.playTwinkleTwinkleLittleStar();
+}
+
+void prepareBuzzerNotes(int i)
+{
+    // 1ms 음으로 큐를 채워 호출마다 음이 바뀌게 함
+    while (!buzzer.isQueueFull())
+        buzzer.addNote(i & 1 ? 440 : 0, 1);
+    if (!buzzer.getIsPlaying())
+        buzzer.play();
+    delay(1);
+}
+
+void runDisplay(unsigned long now)
+{
+    displayManager.update(now);
+}
+
+void prepareDisplayRainbow(int i)
+{
+    if (i == 0)
+        displayManager.rainbowEffect();
+}
+
+void prepareDisplayFrame(int i)
+{
+    if (!displayManager.isMissionCompleteEffectRunning())
+        displayManager.startMissionCompleteEffect(millis());
+    delay(33);
+}
+
+void runCommit(unsigned long now)
+{
+    displayManager.commit(now, true, false);
+}
+
+void prepareCommitDirty(int i)
+{
+    displayManager.setPixelColor(i & 3, i & 0xFF, 0, 0);
+}
+
+void runMissionSame(unsigned long now)
+{
+    displayManager.updateMissionDisplay(0, 3, false, false);
+}
+
+void runMissionChanged(unsigned long now)
+{
+    displayManager.updateMissionDisplay(0, now & 7, false, false);
+}
+
+void runProtocol(unsigned long now)
+{
+    protocol.update(&sink, &CommandSink::onCommand);
+}
+
+void runEeprom(unsigned long now)
+{
+    eepromWriter.update();
+}
+
+void prepareEeprom(int i)
+{
+    if (!eepromWriter.isBusy())
+    {
+        memset(eepromData, i & 0xFF, sizeof(eepromData));
+        eepromWriter.start(512, eepromData, sizeof(eepromData));
+    }
+    delay(4);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+
+    touchBank.addSensor(TOUCH1_PIN);
+    touchBank.addSensor(TOUCH2_PIN);
+    touchBank.addSensor(TOUCH3_PIN);
+    touchBank.init();
+    servoController.init();
+    buzzer.init();
+    displayManager.init();
+    displayManager.initLcd();
+    protocol.begin();
+
+    Serial.println(F("Module update benchmark"));
+}
+
+void loop()
+{
+    Serial.println(F("module\tstate\tavg us\tmax us"));
+
+    runCase(F("TouchBank"), F("now"), noPrepare, runTouchBank);
+    runCase(F("GestureRecognizer"), F("now"), prepareGestures, runGestures);
+
+    runCase(F("ServoAsync"), F("idle"), noPrepare, runServo);
+    runCase(F("ServoAsync"), F("random"), prepareServoRandom, runServo);
+    runCase(F("ServoAsync"), F("complete"), prepareServoComplete, runServo);
+    servoAsync.update(millis());
+
+    runCase(F("PassiveBuzzer"), F("idle"), noPrepare, runBuzzer);
+    runCase(F("PassiveBuzzer"), F("melody"), prepareBuzzerMelody, runBuzzer);
+    runCase(F("PassiveBuzzer"), F("note/call"), prepareBuzzerNotes, runBuzzer);
+    buzzer.stop();
+    buzzer.clear();
+
+    runCase(F("Display::update"), F("idle"), noPrepare, runDisplay);
+    runCase(F("Display::update"), F("rainbow"), prepareDisplayRainbow, runDisplay);
+    runCase(F("Display::update"), F("frame/call"), prepareDisplayFrame, runDisplay);
+    runCase(F("Display::commit"), F("clean"), noPrepare, runCommit);
+    runCase(F("Display::commit"), F("dirty"), prepareCommitDirty, runCommit);
+    runCase(F("Display::mission"), F("same"), noPrepare, runMissionSame);
+    runCase(F("Display::mission"), F("changed"), noPrepare, runMissionChanged);
+
+    runCase(F("CommandProtocol"), F("idle"), noPrepare, runProtocol);
+    runCase(F("EepromWriter"), F("byte/call"), prepareEeprom, runEeprom);
+
+    Serial.println();
+    delay(5000);
+}
@@ -0,0 +1,109 @@
+#include "TouchBank.hpp"
+#include "TouchSensor.hpp"
+
+// ===== 터치 입력 벤치마크 =====
+// TouchSensor 3개(digitalRead 3회) vs 포트 스냅샷 1회 + TouchBank 1개 (SoneeBot과 같은 방식)
+// Timer1을 분주비 1로 돌려 CPU 사이클 단위로 측정 (Servo 라이브러리와 함께 사용 금지)
+
+#define TOUCH1_PIN 8
+#define TOUCH2_PIN 7
+#define TOUCH3_PIN 4
+
+const int ITERATIONS = 1000;
+
+TouchSensor touch1(TOUCH1_PIN);
+TouchSensor touch2(TOUCH2_PIN);
+TouchSensor touch3(TOUCH3_PIN);
+TouchBank touchBank;
+
+void startCycleCounter()
+{
+    TCCR1A = 0;
+    TCCR1B = _BV(CS10); // 분주비 1 (16MHz = 1 사이클/틱)
+}
+
+// 한 틱 측정 후 사이클 수 반환 (측정 오버헤드 제외)
+uint16_t overheadCycles = 0;
+
+uint16_t measureTouchSensors(unsigned long now)
+{
+    uint16_t start = TCNT1;
+    touch1.update(now);
+    touch2.update(now);
+    touch3.update(now);
+    return TCNT1 - start - overheadCycles;
+}
+
+// SoneeBot::readTouchPins와 같은 방식 (포트 스냅샷 한 번, 등록 순서대로 비트)
+uint8_t readTouchPins()
+{
+    PortSnapshot ports;
+    ports.read();
+    return touchBank.readState(ports);
+}
+
+uint16_t measureTouchBank(unsigned long now)
+{
+    uint16_t start = TCNT1;
+    touchBank.update(now, readTouchPins());
+    return TCNT1 - start - overheadCycles;
+}
+
+void printResult(const __FlashStringHelper *name, unsigned long total, uint16_t worst)
+{
+    Serial.print(name);
+    Serial.print(F(" avg: "));
+    Serial.print(total / ITERATIONS);
+    Serial.print(F(" cycles/tick, worst: "));
+    Serial.println(worst);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+
+    touch1.init();
+    touch2.init();
+    touch3.init();
+    touchBank.addSensor(TOUCH1_PIN);
+    touchBank.addSensor(TOUCH2_PIN);
+    touchBank.addSensor(TOUCH3_PIN);
+    touchBank.init();
+
+    startCycleCounter();
+
+    // 빈 측정 구간의 오버헤드 측정
+    uint16_t start = TCNT1;
+    overheadCycles = TCNT1 - start;
+
+    Serial.println(F("Touch input benchmark"));
+}
+
+void loop()
+{
+    unsigned long totalSensors = 0;
+    unsigned long totalBank = 0;
+    uint16_t worstSensors = 0;
+    uint16_t worstBank = 0;
+
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        unsigned long now = millis();
+
+        uint16_t cycles = measureTouchSensors(now);
+        totalSensors += cycles;
+        if (cycles > worstSensors)
+            worstSensors = cycles;
+
+        cycles = measureTouchBank(now);
+        totalBank += cycles;
+        if (cycles > worstBank)
+            worstBank = cycles;
+    }
+
+    printResult(F("3x TouchSensor"), totalSensors, worstSensors);
+    printResult(F("TouchBank     "), totalBank, worstBank);
+    Serial.println();
+
+    delay(2000);
+}
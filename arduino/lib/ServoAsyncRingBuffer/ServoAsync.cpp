@@ -6,11 +6,9 @@ ServoAsync::ServoAsync(int pin)
     currentAngle = 90; // 기본 각도
 
     // 링버퍼 초기화
-    firstAngleMillis = 0;
     currentIndex = 0;
     currentRound = 0;
     bufferCount = 0;
-    lastUpdateTime = 0;
 
     // 배열 초기화
     for (int i = 0; i < QUEUE_SIZE; i++)
@@ -28,12 +26,12 @@ void ServoAsync::init()
 void ServoAsync::update(unsigned long currentMillis)
 {
     // 100Hz 업데이트 (10ms 간격)
-    if (currentMillis - lastUpdateTime >= UPDATE_INTERVAL)
+    if (updateTimer.hasElapsed(currentMillis, UPDATE_INTERVAL))
     {
         if (!isQueueEmpty())
         {
             // 현재 시간을 기준으로 실행할 인덱스 계산
-            unsigned long elapsedTime = currentMillis - firstAngleMillis;
+            uint32_t elapsedTime = firstAngleTimer.elapsed(currentMillis);
             int targetIndex = (int)(elapsedTime / UPDATE_INTERVAL);
 
             // 링버퍼 인덱스 계산 (바퀴 수 고려)
@@ -59,7 +57,7 @@ void ServoAsync::update(unsigned long currentMillis)
             }
         }
 
-        lastUpdateTime = currentMillis;
+        updateTimer.start(currentMillis);
     }
 }
 
@@ -71,18 +69,12 @@ void ServoAsync::moveToAngle(int angle)
 
     // 즉시 실행이므로 버퍼 클리어
     bufferCount = 0;
-    firstAngleMillis = 0;
 }
 
 void ServoAsync::moveSmooth(int targetAngle, int durationMs, unsigned long currentMillis)
 {
     targetAngle = constrain(targetAngle, 0, 180);
 
-    if (currentMillis == 0)
-    {
-        currentMillis = millis();
-    }
-
     int startAngle = currentAngle;
     int steps = abs(targetAngle - startAngle);
 
@@ -107,13 +99,13 @@ void ServoAsync::addToQueue(unsigned long timestamp, int angle)
     // 첫 번째 항목인 경우에만 시작 시간 설정
     if (bufferCount == 0)
     {
-        firstAngleMillis = timestamp;
+        firstAngleTimer.start(timestamp);
         currentRound = 0;
         currentIndex = 0;
     }
 
     // 타임스탬프를 인덱스로 변환
-    unsigned long elapsedTime = timestamp - firstAngleMillis;
+    uint32_t elapsedTime = firstAngleTimer.elapsed(timestamp);
     int totalIndex = (int)(elapsedTime / UPDATE_INTERVAL);
 
     // 링버퍼 인덱스와 라운드 계산
@@ -139,10 +131,10 @@ void ServoAsync::addToQueue(unsigned long timestamp, int angle)
 void ServoAsync::cleanOldCommands(unsigned long currentMillis)
 {
     // 현재 시간보다 1초 이상 오래된 명령들 무시 (링버퍼 특성상 자동으로 처리됨)
-    if (firstAngleMillis > 0 && currentMillis - firstAngleMillis > 30000) // 30초 후 리셋
+    // 비었는지는 bufferCount로만 판단 (millis() 순환 직후에는 시작 시각이 0일 수 있음)
+    if (bufferCount > 0 && firstAngleTimer.elapsed(currentMillis) > 30000) // 30초 후 리셋
     {
         bufferCount = 0;
-        firstAngleMillis = 0;
         currentRound = 0;
         currentIndex = 0;
     }
@@ -158,17 +150,15 @@ bool ServoAsync::isQueueEmpty()
     return bufferCount == 0;
 }
 
-int ServoAsync::getQueueSize()
+int ServoAsync::getQueueSize(unsigned long currentMillis)
 {
-    if (bufferCount == 0 || firstAngleMillis == 0)
+    if (bufferCount == 0)
     {
         return 0; // 버퍼가 비어있으면 0 반환
     }
 
-    unsigned long currentMillis = millis();
-
     // 현재 시간을 기준으로 실행된 인덱스 계산
-    unsigned long elapsedTime = currentMillis - firstAngleMillis;
+    uint32_t elapsedTime = firstAngleTimer.elapsed(currentMillis);
     int currentExecutedIndex = (int)(elapsedTime / UPDATE_INTERVAL);
 
     // 버퍼에 저장된 마지막 인덱스 (bufferCount - 1)
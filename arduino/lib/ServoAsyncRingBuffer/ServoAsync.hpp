@@ -1,6 +1,7 @@
 #ifndef SERVOASYNC_H
 #define SERVOASYNC_H
 
+#include "Timer.hpp" // 스케치 폴더에 복사해서 쓸 때 arduino/Timer.hpp와 함께
 #include <Arduino.h>
 #include <Servo.h>
 
@@ -16,12 +17,12 @@ private:
     static const int UPDATE_INTERVAL = 10;
 
     unsigned char angleBuffer[QUEUE_SIZE];
-    unsigned long firstAngleMillis;
+    Timer firstAngleTimer; // 버퍼 0번 인덱스의 시각
     int currentIndex;
     int currentRound;
     int bufferCount;
 
-    unsigned long lastUpdateTime;
+    Timer updateTimer;
 
 public:
     ServoAsync(int pin);
@@ -30,13 +31,13 @@ public:
     void update(unsigned long currentMillis);
 
     void moveToAngle(int angle);
-    void moveSmooth(int targetAngle, int durationMs, unsigned long currentMillis = 0);
+    void moveSmooth(int targetAngle, int durationMs, unsigned long currentMillis);
     void addToQueue(unsigned long timestamp, int angle);
     void cleanOldCommands(unsigned long currentMillis);
 
     int getCurrentAngle();
     bool isQueueEmpty();
-    int getQueueSize();
+    int getQueueSize(unsigned long currentMillis);
 };
 
 #endif
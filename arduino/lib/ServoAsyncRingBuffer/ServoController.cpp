@@ -41,12 +41,6 @@ void ServoController::update(unsigned long currentMillis)
 
 void ServoController::executeRandomMotion(unsigned long currentMillis)
 {
-    // currentMillis가 0이면 현재 시간을 가져옴 (호환성을 위해)
-    if (currentMillis == 0)
-    {
-        currentMillis = millis();
-    }
-
     int selectedServo = random(1, 3);
 
     if (selectedServo == 1)
@@ -67,12 +61,6 @@ void ServoController::executeRandomMotion(unsigned long currentMillis)
 
 void ServoController::executeMissionDecrease(unsigned long currentMillis)
 {
-    // currentMillis가 0이면 현재 시간을 가져옴 (호환성을 위해)
-    if (currentMillis == 0)
-    {
-        currentMillis = millis();
-    }
-
     // 1단계: 양쪽 서보를 90도로 이동 (500ms 동안)
     for (int i = 0; i <= 5; i++)
     {
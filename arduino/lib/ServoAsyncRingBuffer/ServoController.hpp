@@ -17,8 +17,8 @@ public:
 
     void init();
     void update(unsigned long currentMillis);
-    void executeRandomMotion(unsigned long currentMillis = 0);
-    void executeMissionDecrease(unsigned long currentMillis = 0);
+    void executeRandomMotion(unsigned long currentMillis);
+    void executeMissionDecrease(unsigned long currentMillis);
 
 private:
     // 메모리 체크 함수 추가
@@ -0,0 +1,483 @@
+// 표준 헤더를 Arduino.h의 min/max 매크로보다 먼저
+#include <chrono>
+#include <ucontext.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "SimHal.hpp"
+
+#include "CommandProtocol.hpp"
+#include "Crc8.hpp"
+#include "DisplayManager.hpp"
+#include "EepromWriter.hpp"
+#include "EventBus.hpp"
+#include "GestureRecognizer.hpp"
+#include "MissionManager.hpp"
+#include "PassiveBuzzerManager.hpp"
+#include "ServoAsync.hpp"
+#include "ServoController.hpp"
+#include "SoneeBot.hpp"
+#include "TouchBank.hpp"
+#include "TouchSensor.hpp"
+
+// 모듈별 update() 1회 비용 측정 (호스트)
+// 같은 경우를 타깃에서는 arduino/example/module_benchmark.ino가 micros()로 잼
+//
+// 상태마다 N회 호출하며 호출 사이에 가상 시간을 stepMs만큼 진행.
+// 호스트 사이클은 모듈끼리, 변경 전후끼리 비교용이고 타깃 시간과는 다름.
+// blocked 열은 HAL이 흉내낸 주변장치 대기 시간(LCD, show, EEPROM)으로 타깃에서도 그대로 걸림.
+
+static const uint8_t TOUCH_PINS[3] = {8, 7, 4};
+static const uint8_t BUZZER_PIN = 2;
+
+struct BenchCase
+{
+    const char *module;
+    const char *state;
+    uint16_t stepMs;
+    void (*setup)();
+    void (*prepare)(uint32_t i); // 측정 밖에서 호출 전 준비 (입력, 큐 채우기)
+    void (*run)(unsigned long now);
+};
+
+template <class T, class... Args> static void renew(T *&object, Args... args)
+{
+    delete object;
+    object = new T(args...);
+}
+
+static void drainEvents(EventBus *bus)
+{
+    Event event;
+    while (bus->poll(event))
+    {
+    }
+}
+
+static void driveTouches(uint8_t mask)
+{
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        SimHal::drive(TOUCH_PINS[i], (mask >> i) & 1);
+    }
+}
+
+static void noPrepare(uint32_t i) {}
+
+// ---- 모듈 인스턴스 (경우마다 새로 만듦) ----
+
+static const GestureConfig gestureConfigs[] = {{500, 1000, 300}, {500, 1000, 300}, {500, 1000, 300}};
+static const uint8_t gestureChords[] = {0b011, 0b110};
+static const MissionConfig missionConfigs[] = {{0, 0}, {2, 1440}, {3, 1440}};
+
+static EventBus *bus = 0;
+static TouchSensor *touchSensor = 0;
+static TouchBank *touchBank = 0;
+static GestureRecognizer *gestures = 0;
+static ServoController *servoController = 0;
+static ServoAsync *servoAsync = 0;
+static PassiveBuzzerManager *buzzer = 0;
+static DisplayManager *display = 0;
+static EepromWriter *eepromWriter = 0;
+static MissionManager *missionManager = 0;
+static SoneeBot *robot = 0;
+
+// SoneeBot::readTouchPins와 같은 방식 (포트 스냅샷 한 번, 등록 순서대로 비트)
+static uint8_t readTouches()
+{
+    PortSnapshot ports;
+    ports.read();
+    return touchBank->readState(ports);
+}
+
+static void setupTouchSensor()
+{
+    renew(touchSensor, TOUCH_PINS[0]);
+    touchSensor->init();
+}
+
+static void setupTouchBank()
+{
+    renew(touchBank);
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        touchBank->addSensor(TOUCH_PINS[i]);
+    }
+    touchBank->init();
+}
+
+static void setupGestures()
+{
+    renew(bus);
+    setupTouchBank();
+    renew(gestures, bus, gestureConfigs, gestureChords, (uint8_t)sizeof(gestureChords));
+}
+
+static void setupServo()
+{
+    renew(bus);
+    renew(servoController, 10, 11);
+    servoController->init();
+    renew(servoAsync, servoController, bus);
+}
+
+static void setupBuzzer()
+{
+    renew(buzzer, (int)BUZZER_PIN);
+    buzzer->init();
+}
+
+static void setupDisplay()
+{
+    renew(bus);
+    renew(display, 3, 4, bus);
+    display->init();
+    display->initLcd();
+}
+
+static void setupEeprom()
+{
+    renew(eepromWriter);
+}
+
+static void setupMission()
+{
+    renew(bus);
+    renew(missionManager, bus, missionConfigs, (uint8_t)3);
+    missionManager->init(0);
+}
+
+static void setupRobot()
+{
+    renew(robot);
+    robot->init();
+    // 부팅 단계 끝내기
+    for (unsigned long ms = 1; ms < 3000; ms++)
+    {
+        SimHal::advanceTo(ms * 1000ULL);
+        robot->update(millis());
+    }
+}
+
+// CommandProtocol 핸들러
+struct CommandSink
+{
+    uint32_t count;
+    void onCommand(const Command &command) { count++; }
+};
+
+static CommandProtocol *protocol = 0;
+static CommandSink sink;
+static uint8_t streamFrame[Command::MAX_PAYLOAD + 4];
+static uint8_t streamLength = 0;
+static uint8_t streamPos = 0;
+
+static void setupProtocol()
+{
+    renew(protocol);
+    protocol->begin();
+    sink.count = 0;
+
+    // 최대 길이 프레임 (opcode 0x04 LCD_TEXT)
+    streamFrame[0] = CommandProtocol::FRAME_SYNC;
+    streamFrame[1] = Command::MAX_PAYLOAD;
+    streamFrame[2] = 0x04;
+    for (uint8_t i = 0; i < Command::MAX_PAYLOAD; i++)
+    {
+        streamFrame[3 + i] = 'A' + i;
+    }
+    streamFrame[3 + Command::MAX_PAYLOAD] = crc8(streamFrame + 1, Command::MAX_PAYLOAD + 2);
+    streamLength = Command::MAX_PAYLOAD + 4;
+    streamPos = 0;
+}
+
+static void receivePing()
+{
+    uint8_t frame[4] = {CommandProtocol::FRAME_SYNC, 0, 0x00, 0};
+    frame[3] = crc8(frame + 1, 2);
+    SimHal::receive(frame, sizeof(frame));
+}
+
+static const BenchCase cases[] = {
+    {"TouchSensor::update", "idle", 1, setupTouchSensor, [](uint32_t i) { driveTouches(0); },
+     [](unsigned long now) { touchSensor->update(now); }},
+    {"TouchSensor::update", "held", 1, setupTouchSensor, [](uint32_t i) { driveTouches(1); },
+     [](unsigned long now) { touchSensor->update(now); }},
+    {"TouchSensor::update", "toggle", 1, setupTouchSensor, [](uint32_t i) { driveTouches(i & 1); },
+     [](unsigned long now) { touchSensor->update(now); }},
+
+    {"TouchBank::update x3", "idle", 1, setupTouchBank, [](uint32_t i) { driveTouches(0); },
+     [](unsigned long now) { touchBank->update(now, readTouches()); }},
+    {"TouchBank::update x3", "held", 1, setupTouchBank, [](uint32_t i) { driveTouches(0b111); },
+     [](unsigned long now) { touchBank->update(now, readTouches()); }},
+    {"TouchBank::update x3", "toggle", 1, setupTouchBank, [](uint32_t i) { driveTouches(i & 1 ? 0b111 : 0); },
+     [](unsigned long now) { touchBank->update(now, readTouches()); }},
+
+    {"GestureRecognizer", "idle", 1, setupGestures,
+     [](uint32_t i) {
+         driveTouches(0);
+         touchBank->update(millis(), readTouches());
+     },
+     [](unsigned long now) { gestures->update(touchBank, now); }},
+    {"GestureRecognizer", "held", 10, setupGestures,
+     [](uint32_t i) {
+         drainEvents(bus);
+         driveTouches(0b001);
+         touchBank->update(millis(), readTouches());
+     },
+     [](unsigned long now) { gestures->update(touchBank, now); }},
+    {"GestureRecognizer", "chords", 10, setupGestures,
+     [](uint32_t i) {
+         drainEvents(bus);
+         static const uint8_t masks[4] = {0b011, 0, 0b110, 0};
+         driveTouches(masks[i & 3]);
+         touchBank->update(millis(), readTouches());
+     },
+     [](unsigned long now) { gestures->update(touchBank, now); }},
+
+    {"ServoAsync::update", "idle", 1, setupServo, noPrepare, [](unsigned long now) { servoAsync->update(now); }},
+    {"ServoAsync::update", "random", 1, setupServo,
+     [](uint32_t i) {
+         drainEvents(bus);
+         if (!servoAsync->isAnimationRunning())
+             servoAsync->startRandomMotion(1, millis());
+     },
+     [](unsigned long now) { servoAsync->update(now); }},
+    {"ServoAsync::update", "complete", 1, setupServo,
+     [](uint32_t i) {
+         drainEvents(bus);
+         if (!servoAsync->isAnimationRunning())
+             servoAsync->startMissionCompleteAnimation(millis());
+     },
+     [](unsigned long now) { servoAsync->update(now); }},
+
+    {"PassiveBuzzer::update", "idle", 1, setupBuzzer, noPrepare, [](unsigned long now) { buzzer->update(now); }},
+    {"PassiveBuzzer::update", "melody", 1, setupBuzzer,
+     [](uint32_t i) {
+         if (!buzzer->getIsPlaying())
+             buzzer->playTwinkleTwinkleLittleStar();
+     },
+     [](unsigned long now) { buzzer->update(now); }},
+    {"PassiveBuzzer::update", "note/call", 2, setupBuzzer,
+     [](uint32_t i) {
+         // 호출마다 음이 바뀌도록 1ms 음으로 큐를 채움
+         while (!buzzer->isQueueFull())
+             buzzer->addNote(i & 1 ? 440 : 0, 1);
+         if (!buzzer->getIsPlaying())
+             buzzer->play();
+     },
+     [](unsigned long now) { buzzer->update(now); }},
+
+    {"DisplayManager::update", "idle", 1, setupDisplay, [](uint32_t i) { drainEvents(bus); },
+     [](unsigned long now) { display->update(now); }},
+    {"DisplayManager::update", "rainbow", 1, setupDisplay,
+     [](uint32_t i) {
+         drainEvents(bus);
+         if (i % 600 == 0)
+             display->rainbowEffect();
+     },
+     [](unsigned long now) { display->update(now); }},
+    {"DisplayManager::update", "frame/call", 33, setupDisplay,
+     [](uint32_t i) {
+         drainEvents(bus);
+         if (!display->isMissionCompleteEffectRunning())
+             display->startMissionCompleteEffect(millis());
+     },
+     [](unsigned long now) { display->update(now); }},
+    {"DisplayManager::commit", "clean", 1, setupDisplay, noPrepare,
+     [](unsigned long now) { display->commit(now, true, false); }},
+    {"DisplayManager::commit", "dirty", 1, setupDisplay,
+     [](uint32_t i) { display->setPixelColor(i & 3, i & 0xFF, 0, 0); },
+     [](unsigned long now) { display->commit(now, true, false); }},
+    {"DisplayManager::mission", "same", 1, setupDisplay, noPrepare,
+     [](unsigned long now) { display->updateMissionDisplay(0, 3, false, false); }},
+    {"DisplayManager::mission", "changed", 1, setupDisplay, noPrepare,
+     [](unsigned long now) { display->updateMissionDisplay(0, now & 7, false, false); }},
+
+    {"CommandProtocol::update", "idle", 1, setupProtocol, noPrepare,
+     [](unsigned long now) { protocol->update(&sink, &CommandSink::onCommand); }},
+    {"CommandProtocol::update", "ping", 5, setupProtocol, [](uint32_t i) { receivePing(); },
+     [](unsigned long now) { protocol->update(&sink, &CommandSink::onCommand); }},
+    {"CommandProtocol::update", "full rx", 2, setupProtocol,
+     [](uint32_t i) {
+         // 수신 버퍼를 최대 길이 프레임으로 계속 채움
+         while (SimHal::state.rxCount < SimHal::SERIAL_BUFFER_SIZE - 1)
+         {
+             SimHal::receive(&streamFrame[streamPos], 1);
+             streamPos = (streamPos + 1) % streamLength;
+         }
+     },
+     [](unsigned long now) { protocol->update(&sink, &CommandSink::onCommand); }},
+
+    {"EepromWriter::update", "idle", 1, setupEeprom, noPrepare, [](unsigned long now) { eepromWriter->update(); }},
+    {"EepromWriter::update", "byte/call", 4, setupEeprom,
+     [](uint32_t i) {
+         static uint8_t data[8];
+         if (!eepromWriter->isBusy())
+         {
+             memset(data, i & 0xFF, sizeof(data));
+             eepromWriter->start(512, data, sizeof(data));
+         }
+     },
+     [](unsigned long now) { eepromWriter->update(); }},
+
+    {"MissionManager::update", "idle", 1, setupMission, [](uint32_t i) { drainEvents(bus); },
+     [](unsigned long now) { missionManager->update(now); }},
+    {"MissionManager::update", "check/call", 60000, setupMission, [](uint32_t i) { drainEvents(bus); },
+     [](unsigned long now) { missionManager->update(now); }},
+
+    {"SoneeBot::update", "idle", 1, setupRobot, [](uint32_t i) { driveTouches(0); },
+     [](unsigned long now) { robot->update(now); }},
+    {"SoneeBot::update", "touch held", 1, setupRobot, [](uint32_t i) { driveTouches(0b010); },
+     [](unsigned long now) { robot->update(now); }},
+};
+
+// ---- 측정 ----
+
+#if defined(__x86_64__) || defined(__i386__)
+static const char *CYCLE_UNIT = "tsc";
+static inline uint64_t readCycles()
+{
+    _mm_lfence();
+    uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+}
+#else
+static const char *CYCLE_UNIT = "ns";
+static inline uint64_t readCycles()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+#endif
+
+static uint32_t iterations = 2000;
+static bool csv = false;
+static const char *filter = 0;
+static uint64_t overhead = 0;
+static uint64_t samples[100000];
+
+static int compareSamples(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+static void emptyRun(unsigned long now) {}
+
+// 한 경우를 돌려 정렬된 샘플을 samples에 남김, 호출당 HAL 대기 시간(us) 반환
+static double measure(const BenchCase &benchCase)
+{
+    SimHal::begin();
+    SimHal::tracing = false;
+    benchCase.setup();
+
+    uint64_t blockedStart = 0;
+    unsigned long now = millis();
+    for (uint32_t i = 0; i < iterations + 16; i++)
+    {
+        now += benchCase.stepMs;
+        SimHal::advanceTo(SimHal::now() + (uint64_t)benchCase.stepMs * 1000);
+        now = millis();
+        benchCase.prepare(i);
+
+        uint64_t start = readCycles();
+        benchCase.run(now);
+        uint64_t end = readCycles();
+
+        // 앞의 16회는 캐시 데우기
+        if (i == 15)
+            blockedStart = SimHal::state.counters.blockedUs;
+        if (i >= 16)
+            samples[i - 16] = end - start;
+    }
+    qsort(samples, iterations, sizeof(samples[0]), compareSamples);
+    return (double)(SimHal::state.counters.blockedUs - blockedStart) / iterations;
+}
+
+static uint64_t corrected(uint64_t value)
+{
+    return value > overhead ? value - overhead : 0;
+}
+
+static void benchMain()
+{
+    // 빈 호출의 중앙값을 측정 오버헤드로 뺌
+    BenchCase empty = {"", "", 1, [] {}, noPrepare, emptyRun};
+    measure(empty);
+    overhead = samples[iterations / 2];
+
+    if (csv)
+        printf("module,state,step_ms,min,median,p99,max,mean,blocked_us\n");
+    else
+        printf("%-26s %-11s %5s %8s %8s %8s %9s %12s\n", "module", "state", "step", "min", "median", "p99", "max",
+               "blocked us");
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+        const BenchCase &benchCase = cases[c];
+        if (filter && !strstr(benchCase.module, filter))
+            continue;
+
+        double blocked = measure(benchCase);
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < iterations; i++)
+            total += corrected(samples[i]);
+
+        uint64_t minimum = corrected(samples[0]);
+        uint64_t median = corrected(samples[iterations / 2]);
+        uint64_t p99 = corrected(samples[iterations * 99 / 100]);
+        uint64_t maximum = corrected(samples[iterations - 1]);
+        if (csv)
+            printf("%s,%s,%u,%llu,%llu,%llu,%llu,%.1f,%.1f\n", benchCase.module, benchCase.state, benchCase.stepMs,
+                   (unsigned long long)minimum, (unsigned long long)median, (unsigned long long)p99,
+                   (unsigned long long)maximum, (double)total / iterations, blocked);
+        else
+            printf("%-26s %-11s %5u %8llu %8llu %8llu %9llu %12.1f\n", benchCase.module, benchCase.state,
+                   benchCase.stepMs, (unsigned long long)minimum, (unsigned long long)median,
+                   (unsigned long long)p99, (unsigned long long)maximum, blocked);
+    }
+
+    if (!csv)
+        printf("\n%s per call, %u calls per row, overhead %llu subtracted\n", CYCLE_UNIT, iterations,
+               (unsigned long long)overhead);
+}
+
+// MemoryDiagnostics가 스택을 칠하므로 가상 SRAM 위의 스택에서 실행
+static ucontext_t hostContext;
+static ucontext_t benchContext;
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc)
+            iterations = strtoul(argv[++i], 0, 10);
+        else if (arg == "--csv")
+            csv = true;
+        else if (arg[0] != '-')
+            filter = argv[i];
+        else
+        {
+            fprintf(stderr, "usage: soneebot_bench [-n N] [--csv] [module filter]\n");
+            return 2;
+        }
+    }
+    if (iterations < 100)
+        iterations = 100;
+    if (iterations > sizeof(samples) / sizeof(samples[0]))
+        iterations = sizeof(samples) / sizeof(samples[0]);
+
+    getcontext(&benchContext);
+    benchContext.uc_stack.ss_sp = simSram;
+    benchContext.uc_stack.ss_size = SIM_SRAM_SIZE;
+    benchContext.uc_link = &hostContext;
+    makecontext(&benchContext, benchMain, 0);
+    swapcontext(&hostContext, &benchContext);
+    return 0;
+}
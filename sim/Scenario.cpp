@@ -0,0 +1,251 @@
+#include "Scenario.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdlib.h>
+
+#include "CommandProtocol.hpp"
+#include "Crc8.hpp"
+
+const uint8_t Scenario::TOUCH_PINS[3] = {8, 7, 4};
+
+Scenario::Scenario()
+{
+    cursor = 0;
+    uptimeMs = 0;
+}
+
+static bool parseTime(const std::string &token, uint64_t lastTimeMs, uint64_t &timeMs)
+{
+    std::string text = token;
+    bool relative = !text.empty() && text[0] == '+';
+    if (relative)
+        text = text.substr(1);
+
+    char *end = 0;
+    double value = strtod(text.c_str(), &end);
+    if (end == text.c_str() || value < 0)
+        return false;
+
+    std::string unit(end);
+    double scale;
+    if (unit.empty() || unit == "ms")
+        scale = 1;
+    else if (unit == "s")
+        scale = 1000;
+    else if (unit == "m")
+        scale = 60000;
+    else if (unit == "h")
+        scale = 3600000;
+    else if (unit == "d")
+        scale = 86400000;
+    else
+        return false;
+
+    timeMs = (uint64_t)(value * scale + 0.5) + (relative ? lastTimeMs : 0);
+    return true;
+}
+
+static bool parseHexBytes(std::istringstream &in, std::vector<uint8_t> &bytes)
+{
+    std::string token;
+    while (in >> token)
+    {
+        char *end = 0;
+        unsigned long value = strtoul(token.c_str(), &end, 16);
+        if (*end != '\0' || value > 0xFF)
+            return false;
+        bytes.push_back((uint8_t)value);
+    }
+    return true;
+}
+
+bool Scenario::fail(int lineNumber, const std::string &message)
+{
+    error = "line " + std::to_string(lineNumber) + ": " + message;
+    return false;
+}
+
+bool Scenario::parseLine(const std::string &line, uint64_t &lastTimeMs, int lineNumber)
+{
+    std::string body = line.substr(0, line.find('#'));
+    std::istringstream in(body);
+    std::string timeToken, command;
+    if (!(in >> timeToken))
+        return true; // 빈 줄
+    if (!(in >> command))
+        return fail(lineNumber, "missing command");
+
+    ScenarioEvent event;
+    if (!parseTime(timeToken, lastTimeMs, event.timeMs))
+        return fail(lineNumber, "bad time '" + timeToken + "'");
+    lastTimeMs = event.timeMs;
+    event.pin = 0;
+    event.value = 0;
+    event.size = 0;
+
+    std::string rest;
+    std::getline(in, rest);
+    rest.erase(rest.find_last_not_of(" \t\r") + 1);
+    event.text = command + rest;
+    std::istringstream args(rest);
+
+    if (command == "touch" || command == "tap")
+    {
+        int id = 0;
+        args >> id;
+        if (id < 1 || id > 3)
+            return fail(lineNumber, "touch id must be 1-3");
+        event.type = ScenarioEvent::PIN;
+        event.pin = TOUCH_PINS[id - 1];
+
+        std::string arg;
+        args >> arg;
+        std::string touch = "touch " + std::to_string(id);
+        if (command == "touch")
+        {
+            if (arg != "down" && arg != "up")
+                return fail(lineNumber, "touch needs down|up");
+            event.value = arg == "down" ? HIGH : LOW;
+            event.text = touch + " " + arg;
+            events.push_back(event);
+            return true;
+        }
+
+        uint64_t lengthMs = DEFAULT_TAP_MS;
+        if (!arg.empty() && !parseTime(arg, 0, lengthMs))
+            return fail(lineNumber, "bad tap length '" + arg + "'");
+        event.value = HIGH;
+        event.text = touch + " down";
+        events.push_back(event);
+        event.timeMs += lengthMs;
+        event.value = LOW;
+        event.text = touch + " up";
+        events.push_back(event);
+        return true;
+    }
+
+    if (command == "pin")
+    {
+        int pin = -1;
+        std::string level;
+        args >> pin >> level;
+        if (pin < 0 || pin > 19)
+            return fail(lineNumber, "pin must be 0-19");
+        event.type = ScenarioEvent::PIN;
+        event.pin = pin;
+        if (level == "1")
+            event.value = HIGH;
+        else if (level == "0")
+            event.value = LOW;
+        else if (level == "z")
+            event.value = 0xFF;
+        else
+            return fail(lineNumber, "pin level must be 0|1|z");
+        events.push_back(event);
+        return true;
+    }
+
+    if (command == "serial" || command == "cmd")
+    {
+        std::vector<uint8_t> bytes;
+        if (!parseHexBytes(args, bytes) || bytes.empty())
+            return fail(lineNumber, "expected hex bytes");
+        event.type = ScenarioEvent::SERIAL_RX;
+
+        if (command == "serial")
+        {
+            event.bytes = bytes;
+        }
+        else
+        {
+            // [동기][길이][opcode][payload][crc]
+            uint8_t length = bytes.size() - 1;
+            if (length > Command::MAX_PAYLOAD)
+                return fail(lineNumber, "payload too long");
+            uint8_t sync = CommandProtocol::FRAME_SYNC;
+            event.bytes.push_back(sync);
+            event.bytes.push_back(length);
+            event.bytes.insert(event.bytes.end(), bytes.begin(), bytes.end());
+            event.bytes.push_back(crc8(&event.bytes[1], length + 2));
+        }
+        events.push_back(event);
+        return true;
+    }
+
+    if (command == "heap")
+    {
+        unsigned long size = 0;
+        args >> size;
+        if (size == 0 || size > 4096)
+            return fail(lineNumber, "heap size must be 1-4096");
+        event.type = ScenarioEvent::HEAP;
+        event.size = size;
+        events.push_back(event);
+        return true;
+    }
+
+    if (command == "uptime")
+    {
+        std::string arg;
+        args >> arg;
+        if (event.timeMs != 0)
+            return fail(lineNumber, "uptime only at time 0");
+        if (!parseTime(arg, 0, uptimeMs))
+            return fail(lineNumber, "bad uptime '" + arg + "'");
+        return true;
+    }
+
+    if (command == "screen")
+        event.type = ScenarioEvent::SCREEN;
+    else if (command == "protocol")
+        event.type = ScenarioEvent::PROTOCOL;
+    else if (command == "memory")
+        event.type = ScenarioEvent::MEMORY;
+    else if (command == "leds")
+        event.type = ScenarioEvent::LEDS;
+    else if (command == "reset")
+        event.type = ScenarioEvent::RESET;
+    else if (command == "end")
+        event.type = ScenarioEvent::END;
+    else
+        return fail(lineNumber, "unknown command '" + command + "'");
+
+    events.push_back(event);
+    return true;
+}
+
+bool Scenario::load(const char *path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        error = std::string("cannot open ") + path;
+        return false;
+    }
+
+    std::string line;
+    uint64_t lastTimeMs = 0;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        if (!parseLine(line, lastTimeMs, ++lineNumber))
+            return false;
+    }
+
+    // 같은 시각은 적힌 순서 유지
+    std::stable_sort(events.begin(), events.end(),
+                     [](const ScenarioEvent &a, const ScenarioEvent &b) { return a.timeMs < b.timeMs; });
+    cursor = 0;
+    return true;
+}
+
+uint64_t Scenario::endTime() const
+{
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        if (events[i].type == ScenarioEvent::END)
+            return events[i].timeMs;
+    }
+    return events.empty() ? 0 : events.back().timeMs;
+}
@@ -0,0 +1,74 @@
+#ifndef SCENARIO_HPP
+#define SCENARIO_HPP
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// 입력 타임라인 스크립트
+//   <시각> <명령> [인자...]     시각: 1500, 250ms, 2.5s, 10m, 1h, +200ms(직전 기준)
+//   touch <1-3> down|up        터치 센서 (SoneeBot 기본 핀 8, 7, 4)
+//   tap <1-3> [길이]           누르고 길이(기본 150ms) 뒤에 뗌
+//   pin <번호> 0|1|z           임의 핀 구동, z는 떠 있음
+//   serial <hex...>            수신 바이트
+//   cmd <opcode> [hex...]      명령 프레임 (동기 바이트, 길이, CRC 자동)
+//   screen                     LCD 화면 내용을 트레이스에 기록
+//   protocol                   명령 파서 오류 카운터를 트레이스에 기록
+//   heap <바이트>              힙 끝에 임시 블록을 잡아 채우고 바로 해제 (같은 틱의 String 임시 객체 흉내)
+//   memory                     MemoryDiagnostics 수치와 범위 판정을 트레이스에 기록
+//   leds                       네오픽셀 show() 횟수와 미룬 횟수, 바뀐 것 없이 보낸 횟수를 트레이스에 기록
+//   reset                      전원 재인가 (EEPROM 유지)
+//   uptime <시간>              (시각 0에만) 첫 부팅 때 millis()가 이 값부터 시작, 순환 시험용
+//   end                        시뮬레이션 종료
+struct ScenarioEvent
+{
+    enum Type
+    {
+        PIN,
+        SERIAL_RX,
+        SCREEN,
+        PROTOCOL,
+        HEAP,
+        MEMORY,
+        LEDS,
+        RESET,
+        END
+    };
+
+    uint64_t timeMs;
+    uint8_t type;
+    uint8_t pin;
+    uint8_t value;
+    uint16_t size; // heap 블록 크기
+    std::vector<uint8_t> bytes;
+    std::string text; // 트레이스에 남길 원래 명령
+};
+
+class Scenario
+{
+private:
+    std::vector<ScenarioEvent> events;
+    size_t cursor;
+    uint64_t uptimeMs;
+    std::string error;
+
+    bool parseLine(const std::string &line, uint64_t &lastTimeMs, int lineNumber);
+    bool fail(int lineNumber, const std::string &message);
+
+public:
+    static const uint8_t TOUCH_PINS[3];
+    static const uint16_t DEFAULT_TAP_MS = 150;
+
+    Scenario();
+
+    bool load(const char *path);
+    const std::string &getError() const { return error; }
+
+    bool hasNext() const { return cursor < events.size(); }
+    uint64_t nextTime() const { return events[cursor].timeMs; }
+    const ScenarioEvent &next() { return events[cursor++]; }
+    uint64_t endTime() const;
+    uint64_t getUptime() const { return uptimeMs; }
+};
+
+#endif
@@ -0,0 +1,217 @@
+#include "SimHal.hpp"
+#include <Adafruit_NeoPixel.h>
+#include <EEPROM.h>
+#include <LiquidCrystal_I2C.h>
+#include <Servo.h>
+
+EEPROMClass EEPROM;
+
+// ---- Servo: 각도와 펄스 폭만 기록 ----
+
+Servo::Servo()
+{
+    pin = -1;
+    angle = 90;
+    pulseUs = 1500;
+}
+
+uint8_t Servo::attach(int p)
+{
+    pin = p;
+    SimHal::trace("servo %d attach", pin);
+    return 0;
+}
+
+void Servo::detach()
+{
+    if (pin < 0)
+        return;
+    SimHal::trace("servo %d detach", pin);
+    pin = -1;
+}
+
+void Servo::write(int value)
+{
+    if (value >= MIN_PULSE_WIDTH)
+    {
+        writeMicroseconds(value);
+        return;
+    }
+
+    // 0~180은 각도, 그 이상은 펄스 폭 (실제 라이브러리와 같음)
+    value = constrain(value, 0, 180);
+    SimHal::state.counters.servoWrites++;
+    SimHal::state.outputs++; // 같은 각도라도 서보를 구동 중이면 조용한 상태가 아님
+    uint16_t us = MIN_PULSE_WIDTH + (long)value * (MAX_PULSE_WIDTH - MIN_PULSE_WIDTH) / 180;
+    if (us == pulseUs)
+        return;
+    angle = value;
+    pulseUs = us;
+    if (pin >= 0)
+    {
+        SimHal::trace("servo %d %d %uus", pin, angle, pulseUs);
+    }
+}
+
+void Servo::writeMicroseconds(int value)
+{
+    value = constrain(value, MIN_PULSE_WIDTH, MAX_PULSE_WIDTH);
+    SimHal::state.counters.servoWrites++;
+    SimHal::state.outputs++;
+    if (value == pulseUs)
+        return;
+    angle = (long)(value - MIN_PULSE_WIDTH) * 180 / (MAX_PULSE_WIDTH - MIN_PULSE_WIDTH);
+    pulseUs = value;
+    if (pin >= 0)
+    {
+        SimHal::trace("servo %d %d %uus", pin, angle, pulseUs);
+    }
+}
+
+// ---- LiquidCrystal_I2C: 16x2 화면 내용 유지 ----
+
+LiquidCrystal_I2C *LiquidCrystal_I2C::active = 0;
+
+LiquidCrystal_I2C::LiquidCrystal_I2C(uint8_t addr, uint8_t lcdCols, uint8_t lcdRows)
+{
+    address = addr;
+    cols = lcdCols < MAX_COLS ? lcdCols : MAX_COLS;
+    rows = lcdRows < MAX_ROWS ? lcdRows : MAX_ROWS;
+    col = 0;
+    row = 0;
+    backlightOn = false;
+    memset(screen, 0, sizeof(screen));
+    active = this;
+}
+
+void LiquidCrystal_I2C::init()
+{
+    SimHal::block(SimHal::LCD_INIT_US);
+    SimHal::trace("lcd init 0x%02x %ux%u", address, cols, rows);
+    clear();
+}
+
+void LiquidCrystal_I2C::clear()
+{
+    for (uint8_t r = 0; r < rows; r++)
+    {
+        memset(screen[r], ' ', cols);
+        screen[r][cols] = '\0';
+    }
+    col = 0;
+    row = 0;
+    SimHal::state.counters.lcdBytes++;
+    SimHal::block(SimHal::LCD_CLEAR_US);
+    SimHal::trace("lcd clear");
+}
+
+void LiquidCrystal_I2C::setCursor(uint8_t c, uint8_t r)
+{
+    col = c;
+    row = r < rows ? r : rows - 1;
+    SimHal::state.counters.lcdBytes++;
+    SimHal::flushRuns(); // 커서가 옮겨지면 새 줄로 기록
+    SimHal::block(SimHal::LCD_BYTE_US);
+}
+
+void LiquidCrystal_I2C::backlight()
+{
+    backlightOn = true;
+    SimHal::trace("lcd backlight 1");
+}
+
+void LiquidCrystal_I2C::noBacklight()
+{
+    backlightOn = false;
+    SimHal::trace("lcd backlight 0");
+}
+
+size_t LiquidCrystal_I2C::write(uint8_t c)
+{
+    SimHal::lcdRun(col, row, c);
+    if (col < cols)
+    {
+        screen[row][col] = c;
+    }
+    col++;
+    SimHal::state.counters.lcdBytes++;
+    SimHal::block(SimHal::LCD_BYTE_US);
+    return 1;
+}
+
+// ---- Adafruit_NeoPixel: show()에서 바뀐 프레임만 기록 ----
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, int16_t p, neoPixelType t)
+{
+    count = n < MAX_PIXELS ? n : MAX_PIXELS;
+    pin = p;
+    type = t;
+    everShown = false;
+    memset(pixels, 0, sizeof(pixels));
+    memset(shown, 0, sizeof(shown));
+}
+
+void Adafruit_NeoPixel::begin()
+{
+    pinMode(pin, OUTPUT);
+}
+
+void Adafruit_NeoPixel::show()
+{
+    SimHal::state.counters.ledShows++;
+    SimHal::block(count * SimHal::NEOPIXEL_PIXEL_US + SimHal::NEOPIXEL_LATCH_US);
+
+    // 같은 프레임이어도 선으로는 나가므로 출력으로 셈 (기록은 하지 않음)
+    if (everShown && memcmp(pixels, shown, count * 3) == 0)
+    {
+        SimHal::state.outputs++;
+        return;
+    }
+    everShown = true;
+    memcpy(shown, pixels, count * 3);
+    SimHal::state.counters.ledFrames++;
+
+    // 버퍼 순서(GRB)와 상관없이 RRGGBB로 기록
+    char line[16 + MAX_PIXELS * 7];
+    int length = snprintf(line, sizeof(line), "led %d", pin);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint32_t c = getPixelColor(i);
+        length += snprintf(line + length, sizeof(line) - length, " %06lx", (unsigned long)c);
+    }
+    SimHal::trace("%s", line);
+}
+
+void Adafruit_NeoPixel::clear()
+{
+    memset(pixels, 0, count * 3);
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (n >= count)
+        return;
+    uint8_t *p = pixels + n * 3;
+    uint8_t rOffset = (type >> 4) & 0x03;
+    uint8_t gOffset = (type >> 2) & 0x03;
+    uint8_t bOffset = type & 0x03;
+    p[rOffset] = r;
+    p[gOffset] = g;
+    p[bOffset] = b;
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t c)
+{
+    setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+}
+
+uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const
+{
+    if (n >= count)
+        return 0;
+    const uint8_t *p = pixels + n * 3;
+    uint8_t rOffset = (type >> 4) & 0x03;
+    uint8_t gOffset = (type >> 2) & 0x03;
+    uint8_t bOffset = type & 0x03;
+    return Color(p[rOffset], p[gOffset], p[bOffset]);
+}
@@ -0,0 +1,594 @@
+#include "SimHal.hpp"
+#include <stdarg.h>
+
+SimHal::State SimHal::state;
+bool SimHal::tracing = true;
+HardwareSerial Serial;
+
+// 펌웨어 스택이 올라가는 가상 SRAM과 avr-libc 링커 심볼
+uint8_t simSram[SIM_SRAM_SIZE] __attribute__((aligned(16)));
+int *__brkval = 0;
+asm(".globl __heap_start\n\t.set __heap_start, simSram");
+
+// 정적 초기화 순서와 상관없이 쓸 수 있게 함수 안에 둠
+static std::string &traceBuffer()
+{
+    static std::string buffer;
+    return buffer;
+}
+
+void SimHal::begin()
+{
+    memset(&state, 0, sizeof(state));
+    memset(state.eeprom, 0xFF, sizeof(state.eeprom));
+    memset(state.external, PIN_FLOATING, sizeof(state.external));
+    traceBuffer().clear();
+    powerOn();
+}
+
+void SimHal::powerOn()
+{
+    state.bootUs = state.nowUs;
+    state.uptimeOffsetUs = 0;
+    memset(state.mode, INPUT, sizeof(state.mode));
+    memset(state.output, LOW, sizeof(state.output));
+    state.toneOn = false;
+    state.toneEndUs = 0;
+    state.randomState = 1;
+    state.baud = 0;
+    state.rxHead = 0;
+    state.rxCount = 0;
+    state.txCount = 0;
+    state.txCreditNs = 0;
+    state.eepromBusyUntilUs = 0;
+    updatePorts();
+}
+
+void SimHal::advanceTo(uint64_t us)
+{
+    if (us <= state.nowUs)
+        return;
+
+    uint64_t elapsed = us - state.nowUs;
+    state.nowUs = us;
+
+    // 송신 버퍼는 보드레이트대로 비워짐 (1바이트 = 10비트)
+    if (state.txCount > 0 && state.baud > 0)
+    {
+        uint64_t byteNs = 10000000000ULL / state.baud;
+        state.txCreditNs += elapsed * 1000;
+        uint64_t sent = state.txCreditNs / byteNs;
+        if (sent >= state.txCount)
+        {
+            state.txCount = 0;
+            state.txCreditNs = 0;
+        }
+        else
+        {
+            state.txCount -= sent;
+            state.txCreditNs -= sent * byteNs;
+        }
+    }
+
+    if (state.toneOn && state.toneEndUs != 0 && state.nowUs >= state.toneEndUs)
+    {
+        state.toneOn = false;
+        trace("notone %u", state.tonePin);
+    }
+}
+
+void SimHal::block(uint64_t us)
+{
+    state.counters.blockedUs += us;
+    advanceTo(state.nowUs + us);
+}
+
+void SimHal::drive(uint8_t pin, uint8_t value)
+{
+    if (pin >= PIN_COUNT)
+        return;
+    state.external[pin] = value;
+    state.lastInputUs = state.nowUs;
+    updatePorts();
+}
+
+bool SimHal::anyInputHigh()
+{
+    for (uint8_t pin = 0; pin < PIN_COUNT; pin++)
+    {
+        if (state.external[pin] == HIGH)
+            return true;
+    }
+    return false;
+}
+
+uint8_t SimHal::receive(const uint8_t *data, uint8_t length)
+{
+    uint8_t accepted = 0;
+    for (uint8_t i = 0; i < length; i++)
+    {
+        if (state.rxCount >= SERIAL_BUFFER_SIZE - 1)
+        {
+            state.counters.rxDropped++; // 실제 보드처럼 넘치면 버림
+            continue;
+        }
+        state.rx[(state.rxHead + state.rxCount) % SERIAL_BUFFER_SIZE] = data[i];
+        state.rxCount++;
+        accepted++;
+    }
+    state.counters.rxBytes += accepted;
+    state.lastInputUs = state.nowUs;
+    return accepted;
+}
+
+uint8_t SimHal::pinLevel(uint8_t pin)
+{
+    if (state.mode[pin] == OUTPUT)
+        return state.output[pin];
+    if (state.external[pin] != PIN_FLOATING)
+        return state.external[pin];
+    return state.mode[pin] == INPUT_PULLUP ? HIGH : LOW;
+}
+
+void SimHal::updatePorts()
+{
+    state.portInput[PB] = 0;
+    state.portInput[PC] = 0;
+    state.portInput[PD] = 0;
+    for (uint8_t pin = 0; pin < PIN_COUNT; pin++)
+    {
+        if (pinLevel(pin) == HIGH)
+        {
+            state.portInput[digitalPinToPort(pin)] |= digitalPinToBitMask(pin);
+        }
+    }
+}
+
+void SimHal::serialWrite(uint8_t data)
+{
+    // 버퍼가 차 있으면 실제 Serial.write처럼 한 바이트 빠질 때까지 대기
+    while (state.txCount >= SERIAL_BUFFER_SIZE - 1)
+    {
+        block(10000000ULL / (state.baud ? state.baud : 9600) + 1);
+    }
+    state.txCount++;
+    state.counters.txBytes++;
+
+    if (!tracing)
+    {
+        state.outputs++;
+        return;
+    }
+    if (state.txRunLength == TX_RUN_MAX)
+    {
+        flushRuns();
+    }
+    if (state.txRunLength == 0)
+    {
+        if (state.lcdRunOpen)
+            flushRuns();
+        state.txRunUs = state.nowUs;
+        state.txRunText = true;
+    }
+    state.txRun[state.txRunLength++] = data;
+
+    // 글자 출력은 줄 단위로 끊음
+    if ((data < 0x20 || data > 0x7E) && data != '\r' && data != '\n')
+        state.txRunText = false;
+    if (data == '\n' && state.txRunText)
+        flushRuns();
+}
+
+void SimHal::lcdRun(uint8_t col, uint8_t row, char c)
+{
+    if (!tracing)
+    {
+        state.outputs++;
+        return;
+    }
+    if (state.txRunLength > 0 || (state.lcdRunOpen && state.lcdRunLength == LCD_RUN_MAX))
+    {
+        flushRuns();
+    }
+    if (!state.lcdRunOpen)
+    {
+        state.lcdRunOpen = true;
+        state.lcdRunCol = col;
+        state.lcdRunRow = row;
+        state.lcdRunLength = 0;
+        state.lcdRunUs = state.nowUs;
+    }
+    state.lcdRunText[state.lcdRunLength++] = c;
+}
+
+void SimHal::eepromWrite(uint16_t address, uint8_t value)
+{
+    // 이전 쓰기가 끝날 때까지 대기 (eeprom_write_byte와 같음)
+    if (state.nowUs < state.eepromBusyUntilUs)
+    {
+        block(state.eepromBusyUntilUs - state.nowUs);
+    }
+    state.eeprom[address % EEPROM_SIZE] = value;
+    state.eepromBusyUntilUs = state.nowUs + EEPROM_WRITE_US;
+    state.counters.eepromWrites++;
+    trace("eeprom %u %02x", address, value);
+}
+
+static void appendLine(uint64_t us, const char *text)
+{
+    char stamp[32];
+    snprintf(stamp, sizeof(stamp), "%llu.%03u ", (unsigned long long)(us / 1000), (unsigned)(us % 1000));
+    traceBuffer() += stamp;
+    traceBuffer() += text;
+    traceBuffer() += '\n';
+    SimHal::state.outputs++;
+}
+
+void SimHal::flushRuns()
+{
+    if (state.lcdRunOpen)
+    {
+        state.lcdRunOpen = false;
+        std::string line = "lcd " + std::to_string(state.lcdRunCol) + "," + std::to_string(state.lcdRunRow) + " \"";
+        line.append(state.lcdRunText, state.lcdRunLength);
+        line += '"';
+        appendLine(state.lcdRunUs, line.c_str());
+    }
+
+    if (state.txRunLength > 0)
+    {
+        // 글자만 있으면 문자열로, 아니면 16진수로
+        std::string line = "tx";
+        char hex[4];
+        if (state.txRunText)
+        {
+            line += " \"";
+            for (uint8_t i = 0; i < state.txRunLength; i++)
+            {
+                char c = state.txRun[i];
+                if (c == '\r')
+                    line += "\\r";
+                else if (c == '\n')
+                    line += "\\n";
+                else
+                    line += c;
+            }
+            line += '"';
+        }
+        else
+        {
+            for (uint8_t i = 0; i < state.txRunLength; i++)
+            {
+                snprintf(hex, sizeof(hex), " %02x", state.txRun[i]);
+                line += hex;
+            }
+        }
+        state.txRunLength = 0;
+        appendLine(state.txRunUs, line.c_str());
+    }
+}
+
+void SimHal::trace(const char *format, ...)
+{
+    if (!tracing)
+    {
+        state.outputs++;
+        return;
+    }
+    flushRuns();
+
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    appendLine(state.nowUs, text);
+}
+
+size_t SimHal::traceLength()
+{
+    return traceBuffer().size();
+}
+
+void SimHal::truncateTrace(size_t length)
+{
+    traceBuffer().resize(length);
+}
+
+void SimHal::writeTrace(FILE *out)
+{
+    fwrite(traceBuffer().data(), 1, traceBuffer().size(), out);
+    traceBuffer().clear();
+}
+
+bool SimHal::loadEeprom(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return false;
+    size_t n = fread(state.eeprom, 1, EEPROM_SIZE, file);
+    fclose(file);
+    return n == EEPROM_SIZE;
+}
+
+bool SimHal::saveEeprom(const char *path)
+{
+    FILE *file = fopen(path, "wb");
+    if (!file)
+        return false;
+    size_t n = fwrite(state.eeprom, 1, EEPROM_SIZE, file);
+    fclose(file);
+    return n == EEPROM_SIZE;
+}
+
+// ---- Arduino 코어 API ----
+
+unsigned long millis()
+{
+    // 타깃과 같이 32비트에서 순환
+    return (uint32_t)(SimHal::mcuMicros() / 1000);
+}
+
+unsigned long micros()
+{
+    return (uint32_t)SimHal::mcuMicros();
+}
+
+void delay(unsigned long ms)
+{
+    SimHal::block((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    SimHal::block(us);
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    if (pin >= SimHal::PIN_COUNT || SimHal::state.mode[pin] == mode)
+        return;
+    SimHal::state.mode[pin] = mode;
+    SimHal::updatePorts();
+    SimHal::trace("mode %u %s", pin, mode == OUTPUT ? "out" : (mode == INPUT_PULLUP ? "pullup" : "in"));
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    if (pin >= SimHal::PIN_COUNT)
+        return;
+    value = value ? HIGH : LOW;
+
+    // 입력 핀에 HIGH를 쓰면 풀업이 켜짐
+    if (SimHal::state.mode[pin] != OUTPUT)
+    {
+        SimHal::state.mode[pin] = value ? INPUT_PULLUP : INPUT;
+        SimHal::updatePorts();
+        return;
+    }
+
+    if (SimHal::state.output[pin] == value)
+        return;
+    SimHal::state.output[pin] = value;
+    SimHal::updatePorts();
+    SimHal::trace("pin %u %u", pin, value);
+}
+
+int digitalRead(uint8_t pin)
+{
+    if (pin >= SimHal::PIN_COUNT)
+        return LOW;
+    return SimHal::pinLevel(pin);
+}
+
+int analogRead(uint8_t pin)
+{
+    if (pin >= 14)
+        pin -= 14;
+    return SimHal::pinLevel(pin + 14) ? 1023 : 0;
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+    if (pin >= SimHal::PIN_COUNT)
+        return;
+    SimHal::state.mode[pin] = OUTPUT;
+    SimHal::trace("pwm %u %d", pin, value);
+}
+
+uint8_t digitalPinToPort(uint8_t pin)
+{
+    if (pin < 8)
+        return PD;
+    if (pin < 14)
+        return PB;
+    if (pin < SimHal::PIN_COUNT)
+        return PC;
+    return NOT_A_PORT;
+}
+
+uint8_t digitalPinToBitMask(uint8_t pin)
+{
+    if (pin < 8)
+        return 1 << pin;
+    if (pin < 14)
+        return 1 << (pin - 8);
+    return 1 << ((pin - 14) & 7);
+}
+
+volatile uint8_t *portInputRegister(uint8_t port)
+{
+    return &SimHal::state.portInput[port];
+}
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration)
+{
+    SimHal::state.tonePin = pin;
+    SimHal::state.toneOn = true;
+    SimHal::state.toneEndUs = duration ? SimHal::now() + (uint64_t)duration * 1000 : 0;
+    SimHal::state.counters.tones++;
+    if (duration)
+        SimHal::trace("tone %u %u %lu", pin, frequency, duration);
+    else
+        SimHal::trace("tone %u %u", pin, frequency);
+}
+
+void noTone(uint8_t pin)
+{
+    // 이미 조용하면 출력 변화 없음
+    if (!SimHal::state.toneOn)
+        return;
+    SimHal::state.toneOn = false;
+    SimHal::trace("notone %u", pin);
+}
+
+// avr-libc random()과 같은 Park-Miller 생성기 (같은 시드면 타깃과 같은 수열)
+static long nextRandom()
+{
+    long x = SimHal::state.randomState;
+    if (x == 0)
+        x = 123459876L;
+    long hi = x / 127773L;
+    long lo = x % 127773L;
+    x = 16807L * lo - 2836L * hi;
+    if (x < 0)
+        x += 0x7fffffffL;
+    SimHal::state.randomState = x;
+    return x % (0x7fffffffL + 1UL);
+}
+
+void randomSeed(unsigned long seed)
+{
+    if (seed != 0)
+        SimHal::state.randomState = seed;
+}
+
+long random(long howbig)
+{
+    if (howbig == 0)
+        return 0;
+    return nextRandom() % howbig;
+}
+
+long random(long howsmall, long howbig)
+{
+    if (howsmall >= howbig)
+        return howsmall;
+    return random(howbig - howsmall) + howsmall;
+}
+
+// ---- Print / HardwareSerial ----
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--)
+    {
+        n += write(*buffer++);
+    }
+    return n;
+}
+
+size_t Print::printNumber(unsigned long n, uint8_t base)
+{
+    char buf[8 * sizeof(long) + 1];
+    char *str = &buf[sizeof(buf) - 1];
+    *str = '\0';
+    if (base < 2)
+        base = 10;
+    do
+    {
+        char c = n % base;
+        n /= base;
+        *--str = c < 10 ? c + '0' : c + 'A' - 10;
+    } while (n);
+    return write(str);
+}
+
+size_t Print::print(long v, int base)
+{
+    if (base == 10 && v < 0)
+    {
+        size_t n = print('-');
+        return n + printNumber(-(unsigned long)v, 10);
+    }
+    return printNumber((unsigned long)v, base);
+}
+
+size_t Print::print(double v, int digits)
+{
+    char buf[40];
+    snprintf(buf, sizeof(buf), "%.*f", digits, v);
+    return write(buf);
+}
+
+void HardwareSerial::begin(unsigned long baud)
+{
+    SimHal::state.baud = baud;
+}
+
+int HardwareSerial::available()
+{
+    return SimHal::state.rxCount;
+}
+
+int HardwareSerial::read()
+{
+    if (SimHal::state.rxCount == 0)
+        return -1;
+    uint8_t data = SimHal::state.rx[SimHal::state.rxHead];
+    SimHal::state.rxHead = (SimHal::state.rxHead + 1) % SimHal::SERIAL_BUFFER_SIZE;
+    SimHal::state.rxCount--;
+    return data;
+}
+
+int HardwareSerial::peek()
+{
+    if (SimHal::state.rxCount == 0)
+        return -1;
+    return SimHal::state.rx[SimHal::state.rxHead];
+}
+
+int HardwareSerial::availableForWrite()
+{
+    return SimHal::SERIAL_BUFFER_SIZE - 1 - SimHal::state.txCount;
+}
+
+void HardwareSerial::flush()
+{
+    while (SimHal::state.txCount > 0)
+    {
+        SimHal::block(100);
+    }
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    SimHal::serialWrite(c);
+    return 1;
+}
+
+// ---- avr/eeprom.h ----
+
+bool eeprom_is_ready()
+{
+    return SimHal::now() >= SimHal::state.eepromBusyUntilUs;
+}
+
+uint8_t eeprom_read_byte(const uint8_t *address)
+{
+    return SimHal::state.eeprom[(uintptr_t)address % SimHal::EEPROM_SIZE];
+}
+
+void eeprom_write_byte(uint8_t *address, uint8_t value)
+{
+    SimHal::eepromWrite((uintptr_t)address % SimHal::EEPROM_SIZE, value);
+}
+
+void eeprom_update_byte(uint8_t *address, uint8_t value)
+{
+    if (eeprom_read_byte(address) != value)
+    {
+        eeprom_write_byte(address, value);
+    }
+}
@@ -0,0 +1,119 @@
+#ifndef SIM_HAL_HPP
+#define SIM_HAL_HPP
+
+#include <Arduino.h>
+#include <avr/eeprom.h>
+#include <stdio.h>
+
+// 가상 시간 HAL
+// 모든 하드웨어 상태는 State 하나에 모아 두어 memcpy로 스냅샷/복원 가능
+class SimHal
+{
+public:
+    static const uint8_t PIN_COUNT = 20;         // 우노 D0~D13, A0~A5
+    static const uint8_t PIN_FLOATING = 0xFF;    // 외부에서 구동하지 않는 핀
+    static const uint8_t SERIAL_BUFFER_SIZE = 64;
+    static const uint16_t EEPROM_SIZE = E2END + 1;
+    static const uint16_t EEPROM_WRITE_US = 3400;
+    static const uint16_t LCD_BYTE_US = 500;      // PCF8574 4비트 모드, 100kHz I2C 대략값
+    static const uint16_t LCD_CLEAR_US = 2000;    // clear 명령 대기
+    static const uint16_t LCD_INIT_US = 60000;    // init 안의 delay 합
+    static const uint8_t NEOPIXEL_PIXEL_US = 30;  // 24비트 x 1.25us
+    static const uint8_t NEOPIXEL_LATCH_US = 50;
+    static const uint8_t TX_RUN_MAX = 64;         // tx 트레이스 한 줄 최대 바이트
+    static const uint8_t LCD_RUN_MAX = 40;
+
+    struct Counters
+    {
+        uint32_t tones;
+        uint32_t servoWrites;
+        uint32_t lcdBytes;
+        uint32_t ledShows;
+        uint32_t ledFrames;
+        uint32_t txBytes;
+        uint32_t rxBytes;
+        uint32_t rxDropped;
+        uint32_t eepromWrites;
+        uint64_t blockedUs; // delay, 직렬 포트/EEPROM 대기, 주변장치 전송 시간 합
+    };
+
+    struct State
+    {
+        uint64_t nowUs;   // 시뮬레이션 시작부터의 시간
+        uint64_t bootUs;  // 마지막 전원 인가 시각
+        uint64_t uptimeOffsetUs; // 전원 인가 때 이미 지난 것으로 칠 시간 (millis 순환 시험)
+        uint64_t lastInputUs;
+
+        uint8_t mode[PIN_COUNT];
+        uint8_t output[PIN_COUNT];
+        uint8_t external[PIN_COUNT];
+        volatile uint8_t portInput[PD + 1]; // PINB/PINC/PIND
+
+        uint8_t tonePin;
+        bool toneOn;
+        uint64_t toneEndUs; // 0이면 무기한
+
+        unsigned long randomState;
+
+        unsigned long baud;
+        uint8_t rx[SERIAL_BUFFER_SIZE];
+        uint8_t rxHead;
+        uint8_t rxCount;
+        uint8_t txCount;
+        uint64_t txCreditNs;
+
+        uint8_t eeprom[EEPROM_SIZE];
+        uint64_t eepromBusyUntilUs;
+
+        // 연속된 LCD 문자, 직렬 송신 바이트는 한 줄로 묶어서 기록
+        bool lcdRunOpen;
+        uint8_t lcdRunCol;
+        uint8_t lcdRunRow;
+        uint8_t lcdRunLength;
+        uint64_t lcdRunUs;
+        char lcdRunText[LCD_RUN_MAX + 1];
+        uint8_t txRunLength;
+        bool txRunText;
+        uint64_t txRunUs;
+        uint8_t txRun[TX_RUN_MAX];
+
+        uint32_t outputs; // 트레이스 줄 + 같은 내용의 show()까지, 건너뛰기 판단용
+        Counters counters;
+    };
+
+    static State state;
+
+    static void begin();   // 시뮬레이션 시작: EEPROM 지움, 입력 떠 있음
+    static void powerOn(); // 리셋: EEPROM과 외부 입력은 유지
+    static void advanceTo(uint64_t us);
+    static void block(uint64_t us); // 펌웨어가 기다리는 시간 (delay 등)
+    static uint64_t now() { return state.nowUs; }
+    static void setUptime(uint64_t us) { state.uptimeOffsetUs = us; } // powerOn 직후에만
+    static uint64_t mcuMicros() { return state.nowUs - state.bootUs + state.uptimeOffsetUs; }
+
+    // 외부 입력
+    static void drive(uint8_t pin, uint8_t value);
+    static bool anyInputHigh();
+    static uint8_t receive(const uint8_t *data, uint8_t length);
+    static bool hasPendingInput() { return state.rxCount > 0; }
+
+    // 주변장치 모델에서 사용
+    static uint8_t pinLevel(uint8_t pin);
+    static void updatePorts();
+    static void serialWrite(uint8_t data);
+    static void lcdRun(uint8_t col, uint8_t row, char c);
+    static void eepromWrite(uint16_t address, uint8_t value);
+
+    // 트레이스
+    static bool tracing; // 끄면 기록 없이 출력 횟수만 셈 (벤치마크용)
+    static void trace(const char *format, ...) __attribute__((format(printf, 1, 2)));
+    static void flushRuns();
+    static size_t traceLength();
+    static void truncateTrace(size_t length);
+    static void writeTrace(FILE *out);
+
+    static bool loadEeprom(const char *path);
+    static bool saveEeprom(const char *path);
+};
+
+#endif
@@ -0,0 +1,372 @@
+#include "SimRunner.hpp"
+#include <LiquidCrystal_I2C.h>
+#include <new>
+#include <ucontext.h>
+
+#include "SoneeBot.hpp"
+
+// arduino.ino의 전역 객체
+extern SoneeBot robot;
+
+// SimHal.cpp의 avr-libc 힙 심볼
+extern int __heap_start, *__brkval;
+
+// 펌웨어는 가상 SRAM 위의 별도 스택에서 돌고 loop()마다 호스트로 돌아옴
+static ucontext_t hostContext;
+static ucontext_t firmwareContext;
+
+static void firmwareMain()
+{
+    setup();
+    for (;;)
+    {
+        swapcontext(&firmwareContext, &hostContext);
+        loop();
+    }
+}
+
+// 되돌릴 상태: HAL 전체와 robot 객체 (모듈이 모두 값으로 들어 있음)
+struct Snapshot
+{
+    SimHal::State hal;
+    alignas(SoneeBot) uint8_t robot[sizeof(SoneeBot)];
+};
+
+static Snapshot snapshot;
+
+static void saveSnapshot()
+{
+    memcpy(&snapshot.hal, &SimHal::state, sizeof(SimHal::State));
+    memcpy(snapshot.robot, (void *)&robot, sizeof(SoneeBot));
+}
+
+static void restoreSnapshot()
+{
+    memcpy(&SimHal::state, &snapshot.hal, sizeof(SimHal::State));
+    memcpy((void *)&robot, snapshot.robot, sizeof(SoneeBot));
+}
+
+// 루프 전후 robot 객체에서 바뀐 부분이 "현재 시각 기록"뿐인지 확인
+// (lastMillis = now 같은 필드는 매 틱 바뀌어도 건너뛴 결과와 같음)
+static bool onlyTimestampsChanged(const uint8_t *before, const uint8_t *after, size_t size, unsigned long nowMs)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        if (before[i] == after[i])
+            continue;
+
+        size_t word8 = i & ~(size_t)7;
+        size_t word4 = i & ~(size_t)3;
+        size_t word2 = i & ~(size_t)1;
+        unsigned long value8;
+        uint32_t value4;
+        uint16_t value2;
+        if (word8 + 8 <= size && (memcpy(&value8, after + word8, 8), value8 == nowMs))
+        {
+            i = word8 + 7;
+        }
+        else if (word4 + 4 <= size && (memcpy(&value4, after + word4, 4), value4 == (uint32_t)nowMs))
+        {
+            i = word4 + 3;
+        }
+        else if (word2 + 2 <= size && (memcpy(&value2, after + word2, 2), value2 == (uint16_t)nowMs))
+        {
+            i = word2 + 1;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+SimRunner::SimRunner(Scenario *timeline, FILE *traceOut)
+{
+    scenario = timeline;
+    out = traceOut;
+    exact = false;
+    maxJumpMs = 1000;
+    endMs = 0;
+    nowMs = 0;
+    stride = 1;
+    ended = false;
+    eepromPath = 0;
+    seed = 0;
+    uptimeMs = 0;
+    largestHeapBlock = 0;
+    loops = 0;
+    steps = 0;
+    probes = 0;
+}
+
+void SimRunner::boot()
+{
+    getcontext(&firmwareContext);
+    firmwareContext.uc_stack.ss_sp = simSram;
+    firmwareContext.uc_stack.ss_size = SIM_SRAM_SIZE;
+    firmwareContext.uc_link = 0;
+    makecontext(&firmwareContext, firmwareMain, 0);
+
+    SimHal::trace("boot");
+    swapcontext(&hostContext, &firmwareContext); // setup()
+    SimHal::flushRuns();
+}
+
+void SimRunner::runLoop()
+{
+    loops++;
+    swapcontext(&hostContext, &firmwareContext);
+    SimHal::flushRuns();
+}
+
+void SimRunner::commit()
+{
+    SimHal::writeTrace(out);
+}
+
+void SimRunner::applyEvents(uint64_t timeMs)
+{
+    while (scenario->hasNext() && scenario->nextTime() <= timeMs)
+    {
+        const ScenarioEvent &event = scenario->next();
+        switch (event.type)
+        {
+        case ScenarioEvent::PIN:
+            SimHal::trace("in %s", event.text.c_str());
+            SimHal::drive(event.pin, event.value);
+            break;
+        case ScenarioEvent::SERIAL_RX:
+            SimHal::trace("in %s", event.text.c_str());
+            SimHal::receive(event.bytes.data(), event.bytes.size());
+            break;
+        case ScenarioEvent::SCREEN:
+            dumpScreen();
+            break;
+        case ScenarioEvent::PROTOCOL:
+            dumpProtocol();
+            break;
+        case ScenarioEvent::HEAP:
+            SimHal::trace("in %s", event.text.c_str());
+            transientHeap(event.size);
+            break;
+        case ScenarioEvent::MEMORY:
+            dumpMemory();
+            break;
+        case ScenarioEvent::LEDS:
+            dumpLeds();
+            break;
+        case ScenarioEvent::RESET:
+            SimHal::trace("in reset");
+            robot.~SoneeBot();
+            new (&robot) SoneeBot();
+            SimHal::powerOn();
+            boot();
+            break;
+        case ScenarioEvent::END:
+            ended = true;
+            break;
+        }
+    }
+}
+
+bool SimRunner::step(uint64_t timeMs, bool withEvents)
+{
+    SimHal::advanceTo(timeMs * 1000);
+    nowMs = timeMs;
+    if (withEvents)
+    {
+        applyEvents(timeMs);
+        if (ended)
+        {
+            commit();
+            return false;
+        }
+    }
+
+    uint32_t outputs = SimHal::state.outputs;
+    runLoop();
+    steps++;
+    bool output = SimHal::state.outputs != outputs;
+    commit();
+    return output;
+}
+
+bool SimRunner::probe(uint64_t timeMs)
+{
+    // 출력도 내부 변화도 없으면 그 상태를 그대로 채택, 있으면 되돌림
+    saveSnapshot();
+    size_t mark = SimHal::traceLength();
+    SimHal::advanceTo(timeMs * 1000);
+    runLoop();
+    probes++;
+
+    if (SimHal::state.outputs == snapshot.hal.outputs &&
+        onlyTimestampsChanged(snapshot.robot, (const uint8_t *)&robot, sizeof(SoneeBot), millis()))
+    {
+        nowMs = timeMs;
+        return false;
+    }
+    restoreSnapshot();
+    SimHal::truncateTrace(mark);
+    return true;
+}
+
+bool SimRunner::canJump()
+{
+    if (exact || SimHal::anyInputHigh() || SimHal::hasPendingInput())
+        return false;
+    return SimHal::now() - SimHal::state.lastInputUs >= (uint64_t)SETTLE_MS * 1000;
+}
+
+void SimRunner::dumpScreen()
+{
+    LiquidCrystal_I2C *lcd = LiquidCrystal_I2C::active;
+    if (!lcd)
+        return;
+    for (uint8_t row = 0; row < lcd->getRows(); row++)
+    {
+        SimHal::trace("screen %u \"%s\"", row, lcd->getLine(row));
+    }
+}
+
+void SimRunner::dumpProtocol()
+{
+    CommandProtocol *protocol = robot.getCommandProtocol();
+    SimHal::trace("protocol malformed:%u overflow:%u skipped:%u txdropped:%u", protocol->getMalformedCount(),
+                  protocol->getOverflowCount(), protocol->getSkippedCount(), protocol->getTxDroppedCount());
+}
+
+void SimRunner::transientHeap(uint16_t size)
+{
+    // avr-libc malloc/free처럼 __brkval을 올렸다가 해제하며 되돌림
+    // 펌웨어의 틱당 __brkval 표본에는 잡히지 않고 칠해 둔 canary만 덮어씀
+    int *saved = __brkval;
+    uint8_t *start = saved ? (uint8_t *)saved : (uint8_t *)&__heap_start;
+    __brkval = (int *)(start + size);
+    memset(start, ' ', size);
+    __brkval = saved;
+
+    if (size > largestHeapBlock)
+        largestHeapBlock = size;
+}
+
+void SimRunner::dumpMemory()
+{
+#if SONEEBOT_MEMORY_DIAGNOSTICS
+    MemoryDiagnostics *memory = robot.getMemoryDiagnostics();
+    int heap = memory->getHeapPeak();
+    int stack = memory->getStackHighWater();
+    int unused = memory->getNeverUsedRam();
+    SimHal::trace("memory heap:%d stack:%d unused:%d", heap, stack, unused);
+
+    // 수치는 코드마다 달라 골든에서 가리므로 범위 판정을 따로 남김
+    // (가상 SRAM 64KB에서 펌웨어 스택은 몇 KB, 나머지는 대부분 쓰이지 않음)
+    SimHal::trace("memory check heap>=block:%s stack<8k:%s unused>half:%s", heap >= largestHeapBlock ? "yes" : "no",
+                  stack > 0 && stack < 8192 ? "yes" : "no", unused > SIM_SRAM_SIZE / 2 ? "yes" : "no");
+#endif
+}
+
+void SimRunner::dumpLeds()
+{
+    // HAL이 본 show()는 DisplayManager가 센 것 + init()의 첫 show 1회, 바뀐 것 없이 보낸 show는 0이어야 함
+    DisplayManager *display = robot.getDisplayManager();
+    const SimHal::Counters &c = SimHal::state.counters;
+    SimHal::trace("leds shows:%lu hal:%lu unchanged:%lu deferred:%lu", display->getShowCount(),
+                  (unsigned long)c.ledShows, (unsigned long)(c.ledShows - c.ledFrames), display->getDeferredCount());
+}
+
+void SimRunner::run()
+{
+    SimHal::begin();
+    if (eepromPath)
+    {
+        SimHal::loadEeprom(eepromPath); // 없으면 지워진 EEPROM으로 시작
+    }
+    SimHal::setUptime((uptimeMs ? uptimeMs : scenario->getUptime()) * 1000);
+    randomSeed(seed);
+    boot();
+    commit();
+
+    while (!ended && nowMs < endMs)
+    {
+        // 루프가 주변장치 대기로 시간을 쓴 경우 그 뒤부터
+        uint64_t next = nowMs + 1;
+        uint64_t clockMs = (SimHal::now() + 999) / 1000;
+        if (clockMs > next)
+            next = clockMs;
+
+        uint64_t eventMs = scenario->hasNext() ? scenario->nextTime() : endMs;
+        if (eventMs > endMs)
+            eventMs = endMs;
+
+        if (!canJump())
+        {
+            step(next, true);
+            stride = 1;
+            continue;
+        }
+
+        // 다음 입력 직전까지만 건너뜀 (입력은 정확한 시각에 step으로 적용)
+        uint64_t target = nowMs + stride;
+        if (target > eventMs - 1)
+            target = eventMs - 1;
+        if (target <= next)
+        {
+            step(next, true);
+            stride = 2;
+            continue;
+        }
+
+        if (!probe(target))
+        {
+            commit();
+            stride = stride * 2 > maxJumpMs ? maxJumpMs : stride * 2;
+            continue;
+        }
+
+        // (next - 1, target] 안에서 처음 무언가 일어나는 시각 찾기
+        uint64_t quiet = next - 1;
+        uint64_t loud = target;
+        while (loud - quiet > 1)
+        {
+            uint64_t mid = quiet + (loud - quiet) / 2;
+            if (probe(mid))
+            {
+                loud = mid;
+            }
+            else
+            {
+                // 조용한 구간은 이미 진행한 것으로 채택됨
+                commit();
+                quiet = mid;
+            }
+        }
+        step(loud, false);
+        stride = 1;
+    }
+
+    dumpScreen();
+    commit();
+}
+
+void SimRunner::printStats(FILE *stream, double wallSeconds)
+{
+    const SimHal::Counters &c = SimHal::state.counters;
+    double simSeconds = SimHal::now() / 1e6;
+
+    fprintf(stream, "sim time    %.3f s (wall %.3f s, x%.0f)\n", simSeconds, wallSeconds,
+            wallSeconds > 0 ? simSeconds / wallSeconds : 0.0);
+    fprintf(stream, "loop calls  %llu (steps %llu, jump probes %llu)\n", (unsigned long long)loops,
+            (unsigned long long)steps, (unsigned long long)probes);
+    fprintf(stream, "blocked     %.3f s\n", c.blockedUs / 1e6);
+    fprintf(stream, "tones       %lu\n", (unsigned long)c.tones);
+    fprintf(stream, "servo write %lu\n", (unsigned long)c.servoWrites);
+    fprintf(stream, "lcd bytes   %lu\n", (unsigned long)c.lcdBytes);
+    fprintf(stream, "led shows   %lu (changed %lu, DisplayManager %lu, deferred %lu)\n", (unsigned long)c.ledShows,
+            (unsigned long)c.ledFrames, robot.getDisplayManager()->getShowCount(),
+            robot.getDisplayManager()->getDeferredCount());
+    fprintf(stream, "serial      tx %lu, rx %lu, rx dropped %lu\n", (unsigned long)c.txBytes,
+            (unsigned long)c.rxBytes, (unsigned long)c.rxDropped);
+    fprintf(stream, "eeprom      %lu writes\n", (unsigned long)c.eepromWrites);
+}
@@ -0,0 +1,64 @@
+#ifndef SIM_RUNNER_HPP
+#define SIM_RUNNER_HPP
+
+#include "Scenario.hpp"
+#include "SimHal.hpp"
+
+// setup()/loop()를 가상 시간으로 돌리는 스케줄러
+//
+// 입력이 없을 때는 1ms씩 돌지 않고 보폭을 두 배씩 늘려 다음 사건까지 건너뜀.
+// 건너뛴 시각의 loop()가 출력을 내거나 robot 상태를 "현재 시각 기록" 이외로 바꾸면
+// 스냅샷으로 되돌리고 이분 탐색으로 그 일이 처음 일어나는 시각을 찾아 거기서 실행.
+// 펌웨어 타이머가 "now - last >= interval" 꼴이라 사건 발생 여부가 시간에 단조롭다는 가정.
+// 조건이 성립하면 결과는 --exact(매 1ms)와 같음.
+class SimRunner
+{
+public:
+    static const uint16_t SETTLE_MS = 50; // 입력 변화 뒤 이 시간 동안은 1ms 단위
+
+private:
+    Scenario *scenario;
+    FILE *out;
+    bool exact;
+    uint32_t maxJumpMs;
+    uint64_t endMs;
+    uint64_t nowMs;
+    uint32_t stride;
+    bool ended;
+    const char *eepromPath;
+    unsigned long seed;
+    uint64_t uptimeMs; // 0이면 시나리오의 uptime
+    uint16_t largestHeapBlock; // heap 명령으로 잡았던 가장 큰 블록
+
+    uint64_t loops;
+    uint64_t steps;
+    uint64_t probes;
+
+    void boot();
+    void runLoop();
+    bool step(uint64_t timeMs, bool applyEvents);
+    bool probe(uint64_t timeMs);
+    void applyEvents(uint64_t timeMs);
+    void commit();
+    bool canJump();
+    void dumpScreen();
+    void dumpProtocol();
+    void transientHeap(uint16_t size);
+    void dumpMemory();
+    void dumpLeds();
+
+public:
+    SimRunner(Scenario *timeline, FILE *traceOut);
+
+    void setExact(bool on) { exact = on; }
+    void setMaxJump(uint32_t ms) { maxJumpMs = ms > 0 ? ms : 1; }
+    void setEnd(uint64_t ms) { endMs = ms; }
+    void setEeprom(const char *path) { eepromPath = path; }
+    void setSeed(unsigned long value) { seed = value; }
+    void setUptime(uint64_t ms) { uptimeMs = ms; }
+
+    void run();
+    void printStats(FILE *stream, double wallSeconds);
+};
+
+#endif
@@ -0,0 +1,35 @@
+#!/bin/sh
+# 호스트 시뮬레이터 빌드: arduino/*.cpp를 그대로 가상 HAL(sim/hal)과 링크
+# soneebot_sim: 시나리오 실행기, soneebot_bench: 모듈별 update() 비용 측정
+set -e
+cd "$(dirname "$0")"
+mkdir -p build/obj
+
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-O2 -g"}
+FLAGS="-std=gnu++11 -Wall -Wno-unused-parameter -Ihal -I../arduino"
+
+compile()
+{
+    $CXX $FLAGS $CXXFLAGS -c "$@"
+}
+
+FIRMWARE=""
+for src in ../arduino/*.cpp; do
+    obj=build/obj/$(basename "$src" .cpp).o
+    compile -o "$obj" "$src"
+    FIRMWARE="$FIRMWARE $obj"
+done
+compile -o build/obj/arduino_ino.o -x c++ ../arduino/arduino.ino
+
+HAL=""
+for src in SimHal SimDevices; do
+    compile -o build/obj/$src.o $src.cpp
+    HAL="$HAL build/obj/$src.o"
+done
+
+$CXX $FLAGS $CXXFLAGS -o build/soneebot_sim $FIRMWARE $HAL build/obj/arduino_ino.o \
+    Scenario.cpp SimRunner.cpp main.cpp
+$CXX $FLAGS $CXXFLAGS -o build/soneebot_bench $FIRMWARE $HAL ModuleBench.cpp
+
+echo "built sim/build/soneebot_sim sim/build/soneebot_bench"
@@ -0,0 +1,38 @@
+#!/bin/sh
+# 골든 트레이스 회귀 검사: 시나리오를 다시 돌려 golden/*.trace와 비교
+# 동작을 바꾸지 않는 최적화 전후에 실행, 의도한 변경이면 --update로 새로 기록
+#   sim/check_golden.sh [--update] [trace_diff 옵션...]
+set -e
+cd "$(dirname "$0")"
+
+# MemoryDiagnostics 수치는 코드만 바뀌어도 달라지므로 비교에서 가림
+# (LCD 진단 화면, CMD_MEMORY_REPORT 프레임의 데이터 10바이트 + CRC)
+MEMORY_MASK='(static|heap|stack|free|unused|Free|Hp|Stk|Un):[0-9]+'
+MEMORY_FRAME_MASK='a5 0a 14( [0-9a-f]{2}){11}'
+
+UPDATE=0
+if [ "$1" = "--update" ]; then
+    UPDATE=1
+    shift
+fi
+
+mkdir -p build/traces
+sh build.sh > build/build.log 2>&1 || { cat build/build.log; exit 1; }
+
+FAILED=0
+for golden in golden/*.trace; do
+    name=$(basename "$golden" .trace)
+    trace=build/traces/$name.trace
+    ./build/soneebot_sim --seed 1 -o "$trace" "scenarios/$name.txt"
+
+    if [ $UPDATE = 1 ]; then
+        cp "$trace" "$golden"
+        echo "updated $golden"
+    elif python3 ../tools/trace_diff.py --mask "$MEMORY_MASK" --mask "$MEMORY_FRAME_MASK" "$@" "$golden" "$trace"; then
+        echo "ok      $name"
+    else
+        echo "FAILED  $name"
+        FAILED=1
+    fi
+done
+exit $FAILED
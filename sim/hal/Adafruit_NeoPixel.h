@@ -0,0 +1,47 @@
+#ifndef SIM_ADAFRUIT_NEOPIXEL_H
+#define SIM_ADAFRUIT_NEOPIXEL_H
+
+#include <Arduino.h>
+
+#define NEO_RGB ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRB ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_KHZ800 0x0000
+#define NEO_KHZ400 0x0100
+
+typedef uint16_t neoPixelType;
+
+// 픽셀 버퍼를 객체 안에 두어 스냅샷 복원 시 함께 되돌아가게 함
+class Adafruit_NeoPixel
+{
+public:
+    static const uint16_t MAX_PIXELS = 64;
+
+private:
+    uint16_t count;
+    int16_t pin;
+    neoPixelType type;
+    uint8_t pixels[MAX_PIXELS * 3];
+    uint8_t shown[MAX_PIXELS * 3];
+    bool everShown;
+
+public:
+    Adafruit_NeoPixel(uint16_t n, int16_t p = 6, neoPixelType t = NEO_GRB + NEO_KHZ800);
+
+    void begin();
+    void show();
+    bool canShow() { return true; }
+    void clear();
+    void setBrightness(uint8_t brightness) {}
+    void setPixelColor(uint16_t n, uint32_t c);
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+    uint32_t getPixelColor(uint16_t n) const;
+    uint16_t numPixels() const { return count; }
+    uint8_t *getPixels() { return pixels; }
+
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+};
+
+#endif
@@ -0,0 +1,186 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// 호스트 시뮬레이터용 Arduino 코어 대체 헤더
+// 표준 헤더는 min/max 매크로보다 먼저 포함해야 함
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+#define LED_BUILTIN 13
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+#define PI 3.1415926535897932384626433832795
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define _BV(b) (1 << (b))
+#define bit(b) (1UL << (b))
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+
+#define F(s) (s)
+
+// 우노 포트 번호 (PINB/PINC/PIND)
+#define NOT_A_PORT 0
+#define PB 2
+#define PC 3
+#define PD 4
+
+// 가상 SRAM: 펌웨어는 이 배열 위의 스택에서 돌아감 (MemoryDiagnostics용)
+#define SIM_SRAM_SIZE 65536
+extern "C" uint8_t simSram[SIM_SRAM_SIZE];
+#define RAMEND (simSram + SIM_SRAM_SIZE - 1)
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+
+uint8_t digitalPinToPort(uint8_t pin);
+uint8_t digitalPinToBitMask(uint8_t pin);
+volatile uint8_t *portInputRegister(uint8_t port);
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0);
+void noTone(uint8_t pin);
+
+void randomSeed(unsigned long seed);
+long random(long howbig);
+long random(long howsmall, long howbig);
+
+inline void noInterrupts() {}
+inline void interrupts() {}
+inline void cli() {}
+inline void sei() {}
+
+class String
+{
+private:
+    std::string text;
+
+public:
+    String(const char *s = "") : text(s ? s : "") {}
+    String(const std::string &s) : text(s) {}
+    explicit String(char c) : text(1, c) {}
+    explicit String(unsigned char v) : text(std::to_string((unsigned)v)) {}
+    explicit String(int v) : text(std::to_string(v)) {}
+    explicit String(unsigned int v) : text(std::to_string(v)) {}
+    explicit String(long v) : text(std::to_string(v)) {}
+    explicit String(unsigned long v) : text(std::to_string(v)) {}
+
+    String &operator+=(const String &other)
+    {
+        text += other.text;
+        return *this;
+    }
+    String &operator+=(const char *s)
+    {
+        text += s;
+        return *this;
+    }
+    String &operator+=(char c)
+    {
+        text += c;
+        return *this;
+    }
+    friend String operator+(const String &a, const String &b) { return String(a.text + b.text); }
+    friend String operator+(const char *a, const String &b) { return String(a + b.text); }
+    friend String operator+(const String &a, const char *b) { return String(a.text + b); }
+    bool operator==(const String &other) const { return text == other.text; }
+    bool operator!=(const String &other) const { return text != other.text; }
+    char operator[](unsigned int i) const { return i < text.size() ? text[i] : 0; }
+
+    unsigned int length() const { return text.size(); }
+    const char *c_str() const { return text.c_str(); }
+};
+
+class Print
+{
+private:
+    size_t printNumber(unsigned long n, uint8_t base);
+
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    virtual int availableForWrite() { return 0; }
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(const String &s) { return write(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(int v, int base = DEC) { return print((long)v, base); }
+    size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(long v, int base = DEC);
+    size_t print(unsigned long v, int base = DEC) { return printNumber(v, base); }
+    size_t print(double v, int digits = 2);
+
+    size_t println() { return write("\r\n"); }
+    template <typename T> size_t println(T v)
+    {
+        size_t n = print(v);
+        return n + println();
+    }
+    template <typename T> size_t println(T v, int format)
+    {
+        size_t n = print(v, format);
+        return n + println();
+    }
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+// 보드레이트에 맞춰 가상 시간으로 비워지는 64바이트 송신 버퍼
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long baud);
+    void begin(unsigned long baud, uint8_t config) { begin(baud); }
+    void end() {}
+    int available() override;
+    int read() override;
+    int peek() override;
+    int availableForWrite() override;
+    void flush();
+    size_t write(uint8_t c) override;
+    using Print::write;
+    operator bool() { return true; }
+};
+
+extern HardwareSerial Serial;
+
+void setup();
+void loop();
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef SIM_EEPROM_H
+#define SIM_EEPROM_H
+
+#include <Arduino.h>
+#include <avr/eeprom.h>
+
+struct EEPROMClass
+{
+    uint8_t read(int idx) { return eeprom_read_byte((const uint8_t *)(intptr_t)idx); }
+    void write(int idx, uint8_t val) { eeprom_write_byte((uint8_t *)(intptr_t)idx, val); }
+    void update(int idx, uint8_t val) { eeprom_update_byte((uint8_t *)(intptr_t)idx, val); }
+    uint16_t length() { return E2END + 1; }
+
+    template <typename T> T &get(int idx, T &t)
+    {
+        uint8_t *p = (uint8_t *)&t;
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            p[i] = read(idx + i);
+        }
+        return t;
+    }
+
+    template <typename T> const T &put(int idx, const T &t)
+    {
+        const uint8_t *p = (const uint8_t *)&t;
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            update(idx + i, p[i]);
+        }
+        return t;
+    }
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef SIM_LIQUIDCRYSTAL_I2C_H
+#define SIM_LIQUIDCRYSTAL_I2C_H
+
+#include <Arduino.h>
+
+// 화면 내용과 커서를 흉내내고 출력은 트레이스로 기록
+class LiquidCrystal_I2C : public Print
+{
+public:
+    static const uint8_t MAX_COLS = 20;
+    static const uint8_t MAX_ROWS = 4;
+
+private:
+    uint8_t address;
+    uint8_t cols;
+    uint8_t rows;
+    uint8_t col;
+    uint8_t row;
+    bool backlightOn;
+    char screen[MAX_ROWS][MAX_COLS + 1];
+
+public:
+    static LiquidCrystal_I2C *active; // 시뮬레이터가 화면 내용을 읽을 때 사용
+
+    LiquidCrystal_I2C(uint8_t addr, uint8_t lcdCols, uint8_t lcdRows);
+
+    void init();
+    void begin() { init(); }
+    void clear();
+    void home() { setCursor(0, 0); }
+    void setCursor(uint8_t c, uint8_t r);
+    void backlight();
+    void noBacklight();
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    const char *getLine(uint8_t r) const { return screen[r]; }
+    uint8_t getRows() const { return rows; }
+};
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef SIM_SERVO_H
+#define SIM_SERVO_H
+
+#include <Arduino.h>
+
+#define MIN_PULSE_WIDTH 544
+#define MAX_PULSE_WIDTH 2400
+
+class Servo
+{
+private:
+    int8_t pin;
+    int16_t angle;
+    uint16_t pulseUs;
+
+public:
+    Servo();
+
+    uint8_t attach(int p);
+    void detach();
+    void write(int value);
+    void writeMicroseconds(int value);
+    int read() { return angle; }
+    int readMicroseconds() { return pulseUs; }
+    bool attached() { return pin >= 0; }
+};
+
+#endif
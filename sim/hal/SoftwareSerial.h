@@ -0,0 +1,21 @@
+#ifndef SIM_SOFTWARESERIAL_H
+#define SIM_SOFTWARESERIAL_H
+
+#include <Arduino.h>
+
+// 연결되지 않은 포트: 수신 없음, 송신은 버림
+class SoftwareSerial : public Stream
+{
+public:
+    SoftwareSerial(uint8_t rxPin, uint8_t txPin) {}
+
+    void begin(long baud) {}
+    bool listen() { return true; }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    size_t write(uint8_t c) override { return 1; }
+    using Print::write;
+};
+
+#endif
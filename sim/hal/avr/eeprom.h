@@ -0,0 +1,18 @@
+#ifndef SIM_AVR_EEPROM_H
+#define SIM_AVR_EEPROM_H
+
+#include <stdint.h>
+
+// ATmega328P: 1KB, 바이트당 약 3.4ms 쓰기 시간
+#define E2END 0x3FF
+
+bool eeprom_is_ready();
+uint8_t eeprom_read_byte(const uint8_t *address);
+void eeprom_write_byte(uint8_t *address, uint8_t value);
+void eeprom_update_byte(uint8_t *address, uint8_t value);
+#define eeprom_busy_wait() \
+    do                     \
+    {                      \
+    } while (!eeprom_is_ready())
+
+#endif
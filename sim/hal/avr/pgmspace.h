@@ -0,0 +1,17 @@
+#ifndef SIM_AVR_PGMSPACE_H
+#define SIM_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+// 호스트에는 플래시 주소 공간이 따로 없음
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#endif
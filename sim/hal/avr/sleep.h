@@ -0,0 +1,15 @@
+#ifndef SIM_AVR_SLEEP_H
+#define SIM_AVR_SLEEP_H
+
+// __AVR__가 없으면 IdleManager의 슬립 코드는 컴파일되지 않음
+#define SLEEP_MODE_IDLE 0
+#define SLEEP_MODE_PWR_DOWN 2
+
+inline void set_sleep_mode(unsigned char mode) {}
+inline void sleep_enable() {}
+inline void sleep_disable() {}
+inline void sleep_cpu() {}
+inline void sleep_mode() {}
+inline void sleep_bod_disable() {}
+
+#endif
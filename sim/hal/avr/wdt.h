@@ -0,0 +1,7 @@
+#ifndef SIM_AVR_WDT_H
+#define SIM_AVR_WDT_H
+
+inline void wdt_reset() {}
+inline void wdt_disable() {}
+
+#endif
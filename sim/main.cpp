@@ -0,0 +1,143 @@
+// 표준 헤더를 Arduino.h의 min/max 매크로보다 먼저
+#include <chrono>
+
+#include "SimRunner.hpp"
+
+static void usage()
+{
+    fprintf(stderr,
+            "usage: soneebot_sim [options] scenario.txt\n"
+            "  -o FILE          trace output (default stdout)\n"
+            "  --duration TIME  run until TIME (default: scenario end + 2s)\n"
+            "  --exact          run loop() every 1ms, no time jumps\n"
+            "  --max-jump MS    longest quiet jump (default 1000)\n"
+            "  --eeprom FILE    load EEPROM image before, save after\n"
+            "  --seed N         randomSeed() before setup()\n"
+            "  --uptime TIME    millis() at first boot, e.g. 49.7d (overrides scenario)\n"
+            "  --stats          print counters to stderr\n");
+}
+
+static bool parseMs(const char *text, uint64_t &ms)
+{
+    char *end = 0;
+    double value = strtod(text, &end);
+    std::string unit(end);
+    if (end == text || value < 0)
+        return false;
+    if (unit == "s")
+        value *= 1000;
+    else if (unit == "m")
+        value *= 60000;
+    else if (unit == "h")
+        value *= 3600000;
+    else if (unit == "d")
+        value *= 86400000;
+    else if (!unit.empty() && unit != "ms")
+        return false;
+    ms = (uint64_t)(value + 0.5);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *scenarioPath = 0;
+    const char *tracePath = 0;
+    const char *eepromPath = 0;
+    uint64_t durationMs = 0;
+    bool exact = false;
+    bool stats = false;
+    uint32_t maxJumpMs = 1000;
+    unsigned long seed = 0;
+    uint64_t uptimeMs = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-o" && hasValue)
+            tracePath = argv[++i];
+        else if (arg == "--duration" && hasValue)
+        {
+            if (!parseMs(argv[++i], durationMs))
+            {
+                usage();
+                return 2;
+            }
+        }
+        else if (arg == "--exact")
+            exact = true;
+        else if (arg == "--max-jump" && hasValue)
+            maxJumpMs = strtoul(argv[++i], 0, 10);
+        else if (arg == "--eeprom" && hasValue)
+            eepromPath = argv[++i];
+        else if (arg == "--seed" && hasValue)
+            seed = strtoul(argv[++i], 0, 10);
+        else if (arg == "--uptime" && hasValue)
+        {
+            if (!parseMs(argv[++i], uptimeMs))
+            {
+                usage();
+                return 2;
+            }
+        }
+        else if (arg == "--stats")
+            stats = true;
+        else if (arg[0] != '-' && !scenarioPath)
+            scenarioPath = argv[i];
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    if (!scenarioPath)
+    {
+        usage();
+        return 2;
+    }
+
+    Scenario scenario;
+    if (!scenario.load(scenarioPath))
+    {
+        fprintf(stderr, "%s: %s\n", scenarioPath, scenario.getError().c_str());
+        return 1;
+    }
+
+    FILE *out = stdout;
+    if (tracePath)
+    {
+        out = fopen(tracePath, "w");
+        if (!out)
+        {
+            perror(tracePath);
+            return 1;
+        }
+    }
+
+    SimRunner runner(&scenario, out);
+    runner.setExact(exact);
+    runner.setMaxJump(maxJumpMs);
+    runner.setEnd(durationMs ? durationMs : scenario.endTime() + 2000);
+    runner.setEeprom(eepromPath);
+    runner.setSeed(seed);
+    runner.setUptime(uptimeMs);
+
+    auto started = std::chrono::steady_clock::now();
+    runner.run();
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - started;
+
+    if (eepromPath && !SimHal::saveEeprom(eepromPath))
+    {
+        perror(eepromPath);
+    }
+    if (stats)
+    {
+        runner.printStats(stderr, wall.count());
+    }
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+"""Print the gamma + brightness lookup table used by ColorPipeline.cpp.
+
+    python3 tools/gen_color_lut.py --gamma 2.6 --brightness 50
+
+Each entry maps an 8-bit linear colour component to the byte sent to
+the WS2812: round((i / 255) ** gamma * brightness). Paste the output
+over the table in arduino/ColorPipeline.cpp and keep LED_BRIGHTNESS and
+LED_GAMMA in ColorPipeline.hpp in sync.
+"""
+
+import argparse
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--gamma", type=float, default=2.6)
+    parser.add_argument("--brightness", type=int, default=50)
+    args = parser.parse_args()
+
+    values = [int(round((i / 255.0) ** args.gamma * args.brightness)) for i in range(256)]
+    for row in range(0, 256, 16):
+        print("    " + ", ".join("%3d" % v for v in values[row:row + 16]) + ",")
+
+
+if __name__ == "__main__":
+    main()
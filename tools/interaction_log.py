@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""Export SoneeBot's on-device interaction log and decode it to CSV.
+
+The log (arduino/InteractionLog.hpp) is a ring of 2-byte records in
+EEPROM 128..1023, little endian:
+
+    bit 15      phase (flips each lap of the ring)
+    bits 14-12  type
+    bits 11-10  sensor / mission / chord number
+    bits 9-0    seconds since the previous record
+
+TIME records carry a 12-bit minute count in bits 11-0 for long gaps.
+BOOT records start a new session: the robot has no clock, so the time
+between sessions is unknown. The last session is anchored to wall time
+using the "seconds since last record" value in the export end frame
+([count][0xFF][seconds x 4], odd length so it never looks like records).
+
+A frame lost on the link leaves a gap in the record indices. The export is
+checked against the count in the end frame and requested again (--retries)
+instead of decoding a history with silently missing events.
+
+Examples:
+
+    python3 tools/interaction_log.py --port /dev/rfcomm0 --csv history.csv
+    python3 tools/interaction_log.py --input export.bin
+"""
+
+import argparse
+import csv
+import datetime
+import sys
+import time
+
+from sonee_cmd import FrameDecoder, encode
+
+CMD_LOG_EXPORT = 0x09
+CMD_LOG_DATA = 0x12
+EMPTY = 0xFFFF
+
+TYPE_NAMES = ("time", "boot", "touch", "mission_up", "mission_down", "mission_complete", "chord")
+
+
+class ExportError(Exception):
+    pass
+
+
+def collect(frames):
+    """Reassemble CMD_LOG_DATA frames into (records, seconds since last record).
+
+    Raises ExportError unless indices 0..count-1 from the end frame are all present.
+    """
+    records = {}
+    idle = None
+    count = None
+    for opcode, payload in frames:
+        if opcode != CMD_LOG_DATA or len(payload) < 2:
+            continue
+        index = payload[0] | payload[1] << 8
+        data = payload[2:]
+        if len(data) == 5 and data[0] == 0xFF:
+            count = index
+            idle = int.from_bytes(data[1:], "little")
+            break
+        for i in range(0, len(data) - 1, 2):
+            records[index + i // 2] = data[i] | data[i + 1] << 8
+
+    if count is None:
+        raise ExportError("no end frame")
+    missing = [i for i in range(count) if i not in records]
+    if missing:
+        raise ExportError("%d of %d records missing (first index %d)" % (len(missing), count, missing[0]))
+    return [records[i] for i in range(count)], idle
+
+
+def decode(records):
+    """Yield (session, seconds since session start, type, number)."""
+    session = 0
+    elapsed = 0
+    for record in records:
+        if record == EMPTY:
+            continue
+        kind = (record >> 12) & 0x07
+        if kind == 0:
+            elapsed += (record & 0x0FFF) * 60
+            continue
+        elapsed += record & 0x03FF
+        if kind == 1:
+            session += 1
+            elapsed = 0
+        yield session, elapsed, kind, (record >> 10) & 0x03
+
+
+def export_from_port(args):
+    """Request exports until one arrives complete; returns (records, idle, wall time)."""
+    import serial  # pyserial
+
+    with serial.Serial(args.port, args.baud, timeout=0.05) as port:
+        for attempt in range(1, args.retries + 1):
+            decoder = FrameDecoder()
+            frames = []
+            port.reset_input_buffer()
+            port.write(encode(CMD_LOG_EXPORT))
+            deadline = time.time() + 5
+            finished = False
+            while not finished and time.time() < deadline:
+                for frame in decoder.feed(port.read(256)):
+                    frames.append(frame)
+                    if frame[0] == CMD_LOG_DATA and len(frame[1]) == 7:
+                        finished = True
+                        break
+            now = time.time()
+            try:
+                records, idle = collect(frames)
+                return records, idle, now
+            except ExportError as error:
+                print("export attempt %d/%d failed: %s" % (attempt, args.retries, error), file=sys.stderr)
+    sys.exit("export failed after %d attempts" % args.retries)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="serial device, e.g. /dev/rfcomm0")
+    source.add_argument("--input", help="raw byte capture of an export")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--csv", help="output file (default stdout)")
+    parser.add_argument("--retries", type=int, default=3, help="export attempts before giving up")
+    args = parser.parse_args()
+
+    if args.port:
+        records, idle, now = export_from_port(args)
+    else:
+        with open(args.input, "rb") as capture:
+            frames = FrameDecoder().feed(capture.read())
+        try:
+            records, idle = collect(frames)
+        except ExportError as error:
+            sys.exit("incomplete export in %s: %s" % (args.input, error))
+        now = None
+
+    events = list(decode(records))
+    last_session = events[-1][0] if events else 0
+    end_elapsed = events[-1][1] if events else 0
+
+    out = open(args.csv, "w", newline="") if args.csv else sys.stdout
+    writer = csv.writer(out)
+    writer.writerow(("session", "elapsed_s", "wall_time", "event", "number"))
+    for session, elapsed, kind, number in events:
+        wall = ""
+        if now is not None and idle is not None and session == last_session:
+            stamp = now - idle - (end_elapsed - elapsed)
+            wall = datetime.datetime.fromtimestamp(stamp).isoformat(timespec="seconds")
+        writer.writerow((session, elapsed, wall, TYPE_NAMES[kind], number))
+    if out is not sys.stdout:
+        out.close()
+
+    print("%d records, %d events, %d sessions" % (len(records), len(events), last_session), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Estimate servo pulse and buzzer jitter caused by NeoPixel show().
+
+Adafruit_NeoPixel::show() keeps interrupts disabled for about 30 us per
+pixel. A Servo or tone() interrupt that falls due inside that window
+runs late by the remaining blocked time. This script simulates the
+SoneeBot main loop with and without the DisplayManager commit gating:
+
+  * uncoordinated - show() as soon as the pixel buffer is dirty
+  * coordinated   - show() only after the servo pulses of the current
+                    20 ms frame, and outside buzzer notes unless the
+                    commit has waited DisplayManager::MAX_DEFER_MS
+
+    python3 tools/led_jitter_sim.py --pixels 4 --seconds 600
+"""
+
+import argparse
+import random
+
+FRAME_US = 20000          # Servo refresh interval
+MARGIN_US = 100           # ServoController::isPulseWindowIdle margin
+MAX_DEFER_US = 100 * 1000  # DisplayManager::MAX_DEFER_MS
+LED_FRAME_US = 33 * 1000   # LedAnimator frame interval
+
+
+def pulse_us(angle):
+    return 544 + angle * (2400 - 544) // 180
+
+
+class Melody:
+    """Notes and rests similar to PassiveBuzzerManager::playHappyBirthday."""
+
+    def __init__(self, rng):
+        self.rng = rng
+        self.segments = []  # (start, end, freq)
+        t = 0
+        while t < 10 ** 12:
+            note = rng.choice((250, 500, 1000)) * 1000
+            rest = note // 5
+            freq = rng.choice((523, 587, 659, 698, 784))
+            self.segments.append((t, t + note, freq))
+            t += note + rest
+            if len(self.segments) > 200000:
+                break
+        self.index = 0
+
+    def freq_at(self, t):
+        while self.index + 1 < len(self.segments) and self.segments[self.index + 1][0] <= t:
+            self.index += 1
+        start, end, freq = self.segments[self.index]
+        return freq if start <= t < end else 0
+
+
+def blocked_delay(event_t, windows):
+    """Delay of an interrupt due at event_t given (start, end) blocked windows."""
+    for start, end in windows:
+        if start <= event_t < end:
+            return end - event_t
+    return 0
+
+
+def simulate(args, coordinated):
+    rng = random.Random(args.seed)
+    melody = Melody(rng)
+    show_us = args.pixels * 30 + 10
+    p0, p1 = pulse_us(args.servo1), pulse_us(args.servo2)
+    pulses_end = p0 + p1 + MARGIN_US
+    total_us = args.seconds * 1000000
+
+    windows = []
+    t = 0
+    next_led_frame = 0
+    dirty = False
+    defer_start = None
+    shows = 0
+    forced = 0
+    while t < total_us:
+        if t >= next_led_frame:
+            dirty = True
+            next_led_frame += LED_FRAME_US
+
+        if dirty:
+            frame_pos = t % FRAME_US
+            servo_idle = pulses_end < frame_pos and frame_pos + show_us + MARGIN_US < FRAME_US
+            tone = melody.freq_at(t) != 0
+            if coordinated and not servo_idle:
+                allowed = False
+            elif coordinated and tone:
+                if defer_start is None:
+                    defer_start = t
+                allowed = t - defer_start >= MAX_DEFER_US
+            else:
+                allowed = True
+            if allowed:
+                if coordinated and tone:
+                    forced += 1
+                windows.append((t, t + show_us))
+                shows += 1
+                dirty = False
+                defer_start = None
+                t += show_us
+
+        t += rng.randint(args.loop_min_us, args.loop_max_us)
+
+    # Servo interrupts per frame: channel 0 start, channel 0 end / 1 start, channel 1 end
+    servo_jitter = []
+    w = 0
+    frame = 0
+    while frame * FRAME_US < total_us:
+        base = frame * FRAME_US
+        while w < len(windows) and windows[w][1] < base:
+            w += 1
+        near = windows[w:w + 3]
+        start_delay = blocked_delay(base, near)
+        mid_delay = blocked_delay(base + p0, near)
+        end_delay = blocked_delay(base + p0 + p1, near)
+        servo_jitter.append(max(abs(mid_delay - start_delay), abs(end_delay - mid_delay)))
+        frame += 1
+
+    # A show() during a sounding note delays one tone() toggle
+    tone_hits = []
+    melody.index = 0
+    for start, end in windows:
+        freq = melody.freq_at(start)
+        if freq:
+            half_period = 500000 // freq
+            tone_hits.append(min(end - start, half_period))
+
+    return shows, forced, servo_jitter, tone_hits
+
+
+def percentile(values, pct):
+    if not values:
+        return 0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * pct / 100.0))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--pixels", type=int, default=4)
+    parser.add_argument("--seconds", type=int, default=300)
+    parser.add_argument("--loop-min-us", type=int, default=150)
+    parser.add_argument("--loop-max-us", type=int, default=1500)
+    parser.add_argument("--servo1", type=int, default=30, help="servo 1 angle")
+    parser.add_argument("--servo2", type=int, default=150, help="servo 2 angle")
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    print("pixels=%d show=%dus simulated=%ds" % (args.pixels, args.pixels * 30 + 10, args.seconds))
+    print("%-14s %7s %7s %10s %10s %10s %12s" % (
+        "mode", "shows", "forced", "servo>0", "servo p99", "servo max", "tone glitches"))
+    for coordinated in (False, True):
+        shows, forced, servo, tone = simulate(args, coordinated)
+        hit = sum(1 for j in servo if j > 0)
+        print("%-14s %7d %7d %10d %8dus %8dus %12d" % (
+            "coordinated" if coordinated else "uncoordinated",
+            shows, forced, hit, percentile(servo, 99), max(servo), len(tone)))
+
+
+if __name__ == "__main__":
+    main()
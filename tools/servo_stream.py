@@ -0,0 +1,371 @@
+#!/usr/bin/env python3
+"""Stream a long servo trajectory to SoneeBot with credit-based flow control.
+
+Protocol (arduino/CommandProtocol.hpp, arduino/ServoStream.hpp):
+
+    CMD_STREAM_START               robot clears its jitter buffer
+    CMD_STREAM_POINTS [t lo][t hi][a1][a2] x 1..5
+    CMD_STREAM_END    [0]          play the rest, then finish
+    CMD_STREAM_CREDIT [consumed][free][state]   sent by the robot
+
+The robot reports how many setpoints it has consumed (8-bit wrapping
+counter). The client never has more than CAPACITY setpoints in flight, so
+the jitter buffer cannot overflow.
+
+Examples:
+
+    python3 tools/servo_stream.py --sim --seconds 300
+    python3 tools/servo_stream.py --sim --latency 30 --jitter 80
+    python3 tools/servo_stream.py --port /dev/rfcomm0 --csv dance.csv
+
+A CSV trajectory has rows "time_ms,angle1,angle2". Without one a
+synthetic dance is generated. --sim runs against a simulated robot in
+virtual time (same buffer logic as the firmware) and prints underruns,
+overflows and tracking error.
+"""
+
+import argparse
+import csv
+import math
+import random
+import sys
+import time
+
+from sonee_cmd import CMD_ACK, FrameDecoder, encode
+
+CMD_STREAM_START = 0x06
+CMD_STREAM_POINTS = 0x07
+CMD_STREAM_END = 0x08
+CMD_STREAM_CREDIT = 0x11
+STATUS_BUSY = 0x03
+
+CAPACITY = 16
+PREFILL = 4
+MAX_POINTS_PER_FRAME = 5
+MAX_BYTES_PER_TICK = 16
+
+STREAM_IDLE, STREAM_WAITING, STREAM_PLAYING, STREAM_FINISHED = range(4)
+STATE_NAMES = ("IDLE", "WAITING", "PLAYING", "FINISHED")
+
+
+def synthetic_dance(seconds, step_ms):
+    points = []
+    for t in range(0, int(seconds * 1000), step_ms):
+        s = t / 1000.0
+        a1 = 90 + 60 * math.sin(2 * math.pi * s / 1.5) * math.sin(2 * math.pi * s / 17)
+        a2 = 90 + 60 * math.sin(2 * math.pi * s / 2.3 + 1.0)
+        points.append((t, int(round(a1)), int(round(a2))))
+    return points
+
+
+def load_csv(path):
+    with open(path) as f:
+        return [(int(r[0]), int(r[1]), int(r[2])) for r in csv.reader(f) if r and r[0].strip().isdigit()]
+
+
+def c_div(a, b):
+    """Integer division truncating toward zero, like C."""
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
+
+
+def int16(v):
+    v &= 0xFFFF
+    return v - 0x10000 if v & 0x8000 else v
+
+
+class SimServoStream:
+    """Python model of arduino/ServoStream.cpp."""
+
+    def __init__(self):
+        self.underruns = 0
+        self.overflows = 0
+        self.reset()
+        self.credit_pending = False
+
+    def reset(self):
+        self.points = []
+        self.state = STREAM_IDLE
+        self.ending = False
+        self.starved = False
+        self.play_start = 0
+        self.consumed = 0
+        self.credit_pending = True
+
+    def begin(self):
+        self.reset()
+        self.state = STREAM_WAITING
+
+    def push(self, t, a1, a2):
+        if len(self.points) >= CAPACITY:
+            self.overflows += 1
+            return False
+        self.points.append((t, a1, a2))
+        return True
+
+    def pop(self):
+        self.points.pop(0)
+        self.consumed = (self.consumed + 1) & 0xFF
+        self.credit_pending = True
+
+    def update(self, now):
+        if self.state == STREAM_WAITING:
+            if len(self.points) >= PREFILL or (self.ending and self.points):
+                self.play_start = now - self.points[0][0]
+                self.state = STREAM_PLAYING
+                self.credit_pending = True
+            elif self.ending:
+                self.state = STREAM_FINISHED
+                self.credit_pending = True
+        if self.state != STREAM_PLAYING:
+            return self.state, None
+
+        stream_time = (now - self.play_start) & 0xFFFF
+        while len(self.points) >= 2 and int16(stream_time - self.points[1][0]) >= 0:
+            self.pop()
+        if not self.points:
+            self.state = STREAM_FINISHED
+            self.credit_pending = True
+            return self.state, None
+
+        t0, a1, a2 = self.points[0]
+        elapsed = int16(stream_time - t0)
+        if len(self.points) >= 2 and elapsed > 0:
+            t1, b1, b2 = self.points[1]
+            span = (t1 - t0) & 0xFFFF
+            self.starved = False
+            return self.state, (a1 + c_div((b1 - a1) * elapsed, span), a2 + c_div((b2 - a2) * elapsed, span))
+
+        if len(self.points) == 1 and elapsed >= 0:
+            if self.ending:
+                self.pop()
+            elif not self.starved:
+                self.starved = True
+                self.underruns += 1
+        return self.state, (a1, a2)
+
+
+class SimLink:
+    """One direction of a serial/Bluetooth link in virtual time."""
+
+    def __init__(self, baud, latency, jitter, rng):
+        self.byte_ms = 10000.0 / baud
+        self.latency = latency
+        self.jitter = jitter
+        self.rng = rng
+        self.queue = []  # (arrival time, byte)
+        self.last_arrival = 0.0
+
+    def write(self, now, data):
+        arrival = max(now + self.latency + self.rng.uniform(0, self.jitter), self.last_arrival)
+        for byte in data:
+            arrival += self.byte_ms
+            self.queue.append((arrival, byte))
+        self.last_arrival = arrival
+
+    def available(self, now):
+        count = 0
+        while count < len(self.queue) and self.queue[count][0] <= now:
+            count += 1
+        return count
+
+    def read(self, count):
+        data = bytes(b for _, b in self.queue[:count])
+        del self.queue[:count]
+        return data
+
+
+class SimRobot:
+    """Command parser + ServoStream + ServoAsync streaming path."""
+
+    def __init__(self, rx, tx):
+        self.rx = rx
+        self.tx = tx
+        self.decoder = FrameDecoder()
+        self.stream = SimServoStream()
+        self.angles = None
+        self.max_fill = 0
+
+    def execute(self, opcode, payload):
+        if opcode == CMD_STREAM_START:
+            self.stream.begin()
+            return 0
+        if opcode == CMD_STREAM_POINTS:
+            if not payload or len(payload) % 4 or self.stream.state == STREAM_IDLE:
+                return 1
+            if len(payload) // 4 > CAPACITY - len(self.stream.points):
+                return STATUS_BUSY
+            for i in range(0, len(payload), 4):
+                self.stream.push(payload[i] | payload[i + 1] << 8, payload[i + 2], payload[i + 3])
+            self.max_fill = max(self.max_fill, len(self.stream.points))
+            return 0
+        if opcode == CMD_STREAM_END:
+            if payload[0] == 0:
+                if self.stream.state != STREAM_IDLE:
+                    self.stream.ending = True
+            else:
+                self.stream.reset()
+            return 0
+        return 2
+
+    def tick(self, now):
+        count = min(MAX_BYTES_PER_TICK, self.rx.available(now))
+        for opcode, payload in self.decoder.feed(self.rx.read(count)):
+            status = self.execute(opcode, payload)
+            if opcode != CMD_STREAM_POINTS or status != 0:
+                self.tx.write(now, encode(CMD_ACK, [opcode, status]))
+
+        state, angles = self.stream.update(now)
+        if state == STREAM_PLAYING and angles:
+            self.angles = angles
+
+        if self.stream.credit_pending:
+            s = self.stream
+            self.tx.write(now, encode(CMD_STREAM_CREDIT, [s.consumed, CAPACITY - len(s.points), s.state]))
+            s.credit_pending = False
+
+
+class StreamClient:
+    """Host side: keeps at most CAPACITY setpoints in flight."""
+
+    def __init__(self, points):
+        self.points = points
+        self.next_index = 0
+        self.sent = 0
+        self.consumed = 0
+        self.last_consumed = 0
+        self.state = None
+        self.started = False
+        self.ended = False
+        self.busy = 0
+        self.decoder = FrameDecoder()
+
+    def credits(self):
+        return CAPACITY - (self.sent - self.consumed)
+
+    def on_bytes(self, data):
+        for opcode, payload in self.decoder.feed(data):
+            if opcode == CMD_STREAM_CREDIT and len(payload) == 3:
+                self.consumed += (payload[0] - self.last_consumed) & 0xFF
+                self.last_consumed = payload[0]
+                self.state = payload[2]
+                if self.state == STREAM_WAITING:
+                    self.started = True
+            elif opcode == CMD_ACK and len(payload) == 2 and payload[1] == STATUS_BUSY:
+                self.busy += 1
+
+    def outgoing(self):
+        """Frames to send now."""
+        frames = []
+        if not self.started:
+            return frames
+        while self.next_index < len(self.points) and self.credits() > 0:
+            n = min(MAX_POINTS_PER_FRAME, self.credits(), len(self.points) - self.next_index)
+            payload = []
+            for t, a1, a2 in self.points[self.next_index:self.next_index + n]:
+                payload += [t & 0xFF, (t >> 8) & 0xFF, a1, a2]
+            frames.append(encode(CMD_STREAM_POINTS, payload))
+            self.next_index += n
+            self.sent += n
+        if self.next_index >= len(self.points) and not self.ended:
+            frames.append(encode(CMD_STREAM_END, [0]))
+            self.ended = True
+        return frames
+
+    def finished(self):
+        return self.ended and self.state == STREAM_FINISHED
+
+
+def reference_angles(points, stream_time):
+    """Ideal piecewise-linear trajectory."""
+    lo, hi = 0, len(points) - 1
+    if stream_time >= points[hi][0]:
+        return points[hi][1:]
+    while hi - lo > 1:
+        mid = (lo + hi) // 2
+        if points[mid][0] <= stream_time:
+            lo = mid
+        else:
+            hi = mid
+    (t0, a1, a2), (t1, b1, b2) = points[lo], points[hi]
+    f = (stream_time - t0) / float(t1 - t0)
+    return a1 + (b1 - a1) * f, a2 + (b2 - a2) * f
+
+
+def run_sim(args, points):
+    rng = random.Random(args.seed)
+    to_robot = SimLink(args.baud, args.latency, args.jitter, rng)
+    to_host = SimLink(args.baud, args.latency, args.jitter, rng)
+    robot = SimRobot(to_robot, to_host)
+    client = StreamClient(points)
+
+    to_robot.write(0, encode(CMD_STREAM_START))
+    max_error = 0.0
+    now = 0
+    limit = points[-1][0] + 60000
+    while now < limit and not client.finished():
+        robot.tick(now)
+        s = robot.stream
+        if s.state == STREAM_PLAYING and robot.angles and s.points:
+            ideal = reference_angles(points, (now - s.play_start) & 0xFFFFFFFF)
+            if not s.starved:
+                max_error = max(max_error, abs(robot.angles[0] - ideal[0]), abs(robot.angles[1] - ideal[1]))
+
+        client.on_bytes(to_host.read(to_host.available(now)))
+        for frame in client.outgoing():
+            to_robot.write(now, frame)
+        now += 1
+
+    print("setpoints        %d (%.1f s)" % (len(points), points[-1][0] / 1000.0))
+    print("link             %d baud, latency %d ms + jitter %d ms" % (args.baud, args.latency, args.jitter))
+    print("finished         %s at %.1f s" % ("yes" if client.finished() else "NO", now / 1000.0))
+    print("consumed         %d" % client.consumed)
+    print("max buffer fill  %d / %d" % (robot.max_fill, CAPACITY))
+    print("underruns        %d" % robot.stream.underruns)
+    print("overflows        %d (busy replies %d)" % (robot.stream.overflows, client.busy))
+    print("max track error  %.2f deg" % max_error)
+    return 0 if client.finished() and robot.stream.overflows == 0 else 1
+
+
+def run_port(args, points):
+    import serial  # pyserial
+
+    client = StreamClient(points)
+    with serial.Serial(args.port, args.baud, timeout=0.01) as port:
+        port.write(encode(CMD_STREAM_START))
+        deadline = time.time() + points[-1][0] / 1000.0 + 10
+        while not client.finished() and time.time() < deadline:
+            client.on_bytes(port.read(256))
+            for frame in client.outgoing():
+                port.write(frame)
+        if not client.finished():
+            port.write(encode(CMD_STREAM_END, [1]))
+            sys.exit("stream did not finish (state %s)" % STATE_NAMES[client.state or 0])
+    print("streamed %d setpoints, busy replies %d" % (client.consumed, client.busy))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="serial device, e.g. /dev/rfcomm0")
+    source.add_argument("--sim", action="store_true", help="run against a simulated robot")
+    parser.add_argument("--csv", help="trajectory file (time_ms,angle1,angle2)")
+    parser.add_argument("--seconds", type=float, default=120, help="length of the synthetic dance")
+    parser.add_argument("--step", type=int, default=20, help="synthetic setpoint interval (ms)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--latency", type=int, default=15, help="simulated one-way latency (ms)")
+    parser.add_argument("--jitter", type=int, default=40, help="simulated extra random latency (ms)")
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    points = load_csv(args.csv) if args.csv else synthetic_dance(args.seconds, args.step)
+    if len(points) < 2:
+        sys.exit("trajectory needs at least two setpoints")
+
+    if args.sim:
+        sys.exit(run_sim(args, points))
+    run_port(args, points)
+
+
+if __name__ == "__main__":
+    main()
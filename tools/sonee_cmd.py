@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Send SoneeBot remote-control commands over serial / Bluetooth.
+
+Frame layout (arduino/CommandProtocol.hpp):
+
+    [0xA5][length][opcode][payload x length][crc8(length, opcode, payload)]
+
+Examples:
+
+    python3 tools/sonee_cmd.py --port /dev/rfcomm0 servo 1 90
+    python3 tools/sonee_cmd.py --port /dev/ttyACM0 lcd 0 0 "Hello"
+    python3 tools/sonee_cmd.py --hex led 0 255 0 0 0 255 0
+    python3 tools/sonee_cmd.py --port /dev/ttyACM0 telemetry 100
+    python3 tools/sonee_cmd.py --port /dev/ttyACM0 diagnostics
+    python3 tools/sonee_cmd.py --port /dev/ttyACM0 diagnostics --interval 10
+
+--hex prints the encoded frame instead of sending it, so byte streams can
+be inspected or piped into other tools.
+"""
+
+import argparse
+import sys
+import time
+
+FRAME_SYNC = 0xA5
+CMD_PING = 0x00
+CMD_SERVO_TARGET = 0x01
+CMD_MELODY = 0x02
+CMD_LED_FRAME = 0x03
+CMD_LCD_TEXT = 0x04
+CMD_TELEMETRY_RATE = 0x05
+CMD_DIAGNOSTICS = 0x0A
+CMD_TELEMETRY = 0x10
+CMD_MEMORY_REPORT = 0x14
+CMD_ACK = 0x7F
+
+STATUS_NAMES = {0x00: "OK", 0x01: "BAD_ARGUMENT", 0x02: "UNKNOWN"}
+MEMORY_FIELDS = ("static", "heap", "stack", "free", "unused")
+
+
+def crc8(data, crc=0):
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def encode(opcode, payload=b""):
+    payload = bytes(payload)
+    body = bytes([len(payload), opcode]) + payload
+    return bytes([FRAME_SYNC]) + body + bytes([crc8(body)])
+
+
+class FrameDecoder:
+    """Incremental decoder for frames sent back by the robot."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+
+    def feed(self, data):
+        self.buffer.extend(data)
+        frames = []
+        while True:
+            start = self.buffer.find(bytes([FRAME_SYNC]))
+            if start < 0:
+                self.buffer.clear()
+                return frames
+            del self.buffer[:start]
+            if len(self.buffer) < 4:
+                return frames
+            length = self.buffer[1]
+            end = 3 + length + 1
+            if len(self.buffer) < end:
+                return frames
+            body = bytes(self.buffer[1:3 + length])
+            if crc8(body) == self.buffer[end - 1]:
+                frames.append((body[1], body[2:]))
+                del self.buffer[:end]
+            else:
+                del self.buffer[:1]
+
+
+def build(args):
+    if args.command == "ping":
+        return encode(CMD_PING)
+    if args.command == "servo":
+        return encode(CMD_SERVO_TARGET, [args.servo, args.angle])
+    if args.command == "melody":
+        return encode(CMD_MELODY, [args.id])
+    if args.command == "led":
+        return encode(CMD_LED_FRAME, [args.start] + args.rgb)
+    if args.command == "lcd":
+        return encode(CMD_LCD_TEXT, [args.row, args.col] + list(args.text.encode("ascii")[:18]))
+    if args.command == "telemetry":
+        return encode(CMD_TELEMETRY_RATE, [min(255, args.interval // 10)])
+    if args.command == "diagnostics":
+        if args.interval is None:
+            return encode(CMD_DIAGNOSTICS)
+        return encode(CMD_DIAGNOSTICS, [min(255, args.interval)])
+    raise ValueError(args.command)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", help="serial device, e.g. /dev/rfcomm0")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--hex", action="store_true", help="print the frame instead of sending")
+    sub = parser.add_subparsers(dest="command", required=True)
+    sub.add_parser("ping")
+    p = sub.add_parser("servo")
+    p.add_argument("servo", type=int, choices=(0, 1, 2), help="0 = both")
+    p.add_argument("angle", type=int)
+    p = sub.add_parser("melody")
+    p.add_argument("id", type=int, help="0-12, 255 = stop")
+    p = sub.add_parser("led")
+    p.add_argument("start", type=int)
+    p.add_argument("rgb", type=int, nargs="+", help="r g b triples")
+    p = sub.add_parser("lcd")
+    p.add_argument("row", type=int)
+    p.add_argument("col", type=int)
+    p.add_argument("text")
+    p = sub.add_parser("telemetry")
+    p.add_argument("interval", type=int, help="ms between frames (10-2550), 0 = off")
+    p = sub.add_parser("diagnostics", help="show the memory screen on the LCD until the next touch")
+    p.add_argument("--interval", type=int, help="instead send a memory report every N seconds, 0 = off")
+    args = parser.parse_args()
+
+    frame = build(args)
+    if args.hex or not args.port:
+        print(" ".join("%02X" % b for b in frame))
+        return
+
+    import serial  # pyserial
+
+    # 메모리 화면 요청은 ACK 뒤에 오는 보고 프레임까지 기다림
+    want_report = args.command == "diagnostics" and args.interval is None
+    acked = False
+    with serial.Serial(args.port, args.baud, timeout=0.1) as port:
+        port.write(frame)
+        decoder = FrameDecoder()
+        deadline = time.time() + 1.0
+        while time.time() < deadline:
+            for opcode, payload in decoder.feed(port.read(64)):
+                if opcode == CMD_ACK and len(payload) == 2 and payload[0] == frame[2]:
+                    print("ACK opcode=0x%02X status=%s" % (payload[0], STATUS_NAMES.get(payload[1], payload[1])))
+                    if not want_report or payload[1] != 0:
+                        return
+                    acked = True
+                elif opcode == CMD_MEMORY_REPORT and acked and len(payload) == 2 * len(MEMORY_FIELDS):
+                    values = [int.from_bytes(payload[i:i + 2], "little", signed=True) for i in range(0, len(payload), 2)]
+                    print(" ".join("%s:%d" % field for field in zip(MEMORY_FIELDS, values)))
+                    return
+        sys.exit("no memory report received" if acked else "no ACK received")
+
+
+if __name__ == "__main__":
+    main()
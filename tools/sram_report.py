@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Summarize SRAM (.data + .bss) usage per translation unit.
+
+Build the sketch with a fixed build path first, e.g.
+
+    arduino-cli compile -b arduino:avr:uno --build-path build arduino
+
+then run
+
+    python3 tools/sram_report.py build
+
+Every object file under the build path is measured with avr-size and the
+results are printed largest first, together with the totals of the final
+.elf and the share of the ATmega328P's 2048 bytes of SRAM.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+SRAM_SIZE = 2048
+
+
+def section_sizes(path, size_tool):
+    """Return (text, data, bss) of an object or elf file using Berkeley format."""
+    out = subprocess.run([size_tool, "-B", path], check=True,
+                         capture_output=True, text=True).stdout
+    fields = out.splitlines()[1].split()
+    return int(fields[0]), int(fields[1]), int(fields[2])
+
+
+def unit_name(build_path, obj_path):
+    name = os.path.relpath(obj_path, build_path)
+    return name[:-2] if name.endswith(".o") else name
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("build_path", help="arduino-cli --build-path directory")
+    parser.add_argument("--size-tool", default="avr-size", help="avr-size executable")
+    parser.add_argument("--all", action="store_true", help="also list units without SRAM usage")
+    args = parser.parse_args()
+
+    rows = []
+    elf = None
+    for root, _, files in os.walk(args.build_path):
+        for name in files:
+            path = os.path.join(root, name)
+            if name.endswith(".o"):
+                text, data, bss = section_sizes(path, args.size_tool)
+                rows.append((data + bss, data, bss, text, unit_name(args.build_path, path)))
+            elif name.endswith(".elf"):
+                elf = path
+
+    if not rows:
+        sys.exit("no object files under %s" % args.build_path)
+
+    rows.sort(reverse=True)
+    print("%6s %6s %6s %7s  %s" % ("sram", "data", "bss", "flash", "unit"))
+    for sram, data, bss, text, name in rows:
+        if sram or args.all:
+            print("%6d %6d %6d %7d  %s" % (sram, data, bss, text + data, name))
+
+    if elf:
+        text, data, bss = section_sizes(elf, args.size_tool)
+        static = data + bss
+        print()
+        print("linked: .data %d + .bss %d = %d bytes static SRAM (%.1f%% of %d)"
+              % (data, bss, static, 100.0 * static / SRAM_SIZE, SRAM_SIZE))
+        print("left for heap + stack: %d bytes" % (SRAM_SIZE - static))
+
+
+if __name__ == "__main__":
+    main()
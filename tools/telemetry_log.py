@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Log or plot the SoneeBot binary telemetry stream.
+
+Telemetry frames (arduino/Telemetry.hpp) use the command framing with
+opcode 0x10 and payload
+
+    [sequence][changed mask][value for each set bit, in field order]
+
+Only changed fields are sent; every tenth period carries all fields, even
+when nothing changed, so a decoder that joins late or loses a frame
+resynchronises within ten periods.
+
+Examples:
+
+    python3 tools/telemetry_log.py --port /dev/ttyACM0 --rate 50 --csv run.csv
+    python3 tools/telemetry_log.py --port /dev/rfcomm0 --plot
+    python3 tools/telemetry_log.py --input capture.bin --csv run.csv
+
+--input decodes a raw byte capture instead of a live port.
+"""
+
+import argparse
+import csv
+import sys
+import time
+
+from sonee_cmd import CMD_TELEMETRY, CMD_TELEMETRY_RATE, FrameDecoder, encode
+
+FIELDS = ("servo1", "servo2", "touch_mask", "mission", "buzzer_queue")
+
+
+class TelemetryState:
+    """Applies delta frames to the last known robot state."""
+
+    def __init__(self):
+        self.values = [None] * len(FIELDS)
+        self.sequence = None
+        self.lost = 0
+
+    def apply(self, payload):
+        if len(payload) < 2:
+            return False
+        sequence, mask = payload[0], payload[1]
+        if self.sequence is not None:
+            self.lost += (sequence - self.sequence - 1) & 0xFF
+        self.sequence = sequence
+
+        values = iter(payload[2:])
+        for i in range(len(FIELDS)):
+            if mask & (1 << i):
+                value = next(values, None)
+                if value is None:
+                    return False
+                self.values[i] = value
+        return True
+
+    def complete(self):
+        return all(v is not None for v in self.values)
+
+
+def frames_from_port(args):
+    import serial  # pyserial
+
+    with serial.Serial(args.port, args.baud, timeout=0.05) as port:
+        if args.rate is not None:
+            port.write(encode(CMD_TELEMETRY_RATE, [min(255, args.rate // 10)]))
+        decoder = FrameDecoder()
+        try:
+            while True:
+                for frame in decoder.feed(port.read(256)):
+                    yield time.time(), frame
+        finally:
+            if args.rate is not None:
+                port.write(encode(CMD_TELEMETRY_RATE, [0]))
+
+
+def frames_from_file(path):
+    decoder = FrameDecoder()
+    with open(path, "rb") as capture:
+        for frame in decoder.feed(capture.read()):
+            yield None, frame
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="serial device, e.g. /dev/ttyACM0")
+    source.add_argument("--input", help="raw byte capture to decode")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--rate", type=int, help="enable telemetry at this interval (ms) and disable on exit")
+    parser.add_argument("--csv", help="write samples to this file (default stdout)")
+    parser.add_argument("--plot", action="store_true", help="live plot with matplotlib")
+    args = parser.parse_args()
+
+    frames = frames_from_port(args) if args.port else frames_from_file(args.input)
+    out = open(args.csv, "w", newline="") if args.csv else sys.stdout
+    writer = csv.writer(out)
+    writer.writerow(("time", "sequence") + FIELDS)
+
+    plot = None
+    if args.plot:
+        import matplotlib.pyplot as plt
+
+        plt.ion()
+        figure, axes = plt.subplots(len(FIELDS), 1, sharex=True)
+        history = [[] for _ in FIELDS]
+        times = []
+        plot = (plt, axes, history, times)
+
+    state = TelemetryState()
+    start = None
+    try:
+        for timestamp, (opcode, payload) in frames:
+            if opcode != CMD_TELEMETRY or not state.apply(payload) or not state.complete():
+                continue
+            if timestamp is not None and start is None:
+                start = timestamp
+            elapsed = "" if timestamp is None else "%.3f" % (timestamp - start)
+            writer.writerow((elapsed, state.sequence) + tuple(state.values))
+
+            if plot:
+                plt, axes, history, times = plot
+                times.append(timestamp - start if timestamp else len(times))
+                for i, axis in enumerate(axes):
+                    history[i].append(state.values[i])
+                    axis.clear()
+                    axis.set_ylabel(FIELDS[i])
+                    axis.step(times[-500:], history[i][-500:], where="post")
+                plt.pause(0.001)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if out is not sys.stdout:
+            out.close()
+        if state.lost:
+            print("lost frames: %d" % state.lost, file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""Compare a simulator trace against a golden trace with timing tolerance.
+
+Traces come from sim/build/soneebot_sim (see sim/README.md), one output per
+line:
+
+    <ms>.<us> <kind> <args>
+
+Lines are split into channels (each servo pin, the buzzer pin, the LCD, the
+NeoPixel strip, serial TX, ...).  Within a channel the sequence of outputs
+must match exactly and every output may move by at most --tolerance ms.
+Outputs of different channels may reorder freely, so a refactor that moves
+an LCD write before a servo write in the same tick still passes.
+
+Binary serial output is cut wherever the UART buffer happened to be full, so
+hex "tx" lines are joined and re-split into command frames
+([0xA5][length][opcode][payload][crc]) before comparing.  Each frame counts as
+one output at the time of its first byte.
+
+    python3 tools/trace_diff.py sim/golden/basic_touch.trace new.trace
+    python3 tools/trace_diff.py --tolerance 20 --ignore tx,eeprom golden.trace new.trace
+    python3 tools/trace_diff.py --mask 'Free:[0-9]+' golden.trace new.trace
+
+--mask replaces every match of a regular expression with "*" before
+comparing (after frames are re-split), for values that legitimately change
+between builds such as the MemoryDiagnostics numbers.
+
+Exit status is 0 when the traces match and 1 otherwise.
+"""
+
+import argparse
+import re
+import sys
+from collections import OrderedDict
+
+# 첫 인자(핀 번호)까지 채널 이름에 넣는 종류
+PIN_KINDS = ("mode", "pin", "pwm", "servo", "led")
+
+FRAME_SYNC = 0xA5
+
+
+class Output:
+    def __init__(self, line_number, ms, kind, args):
+        self.line_number = line_number
+        self.ms = ms
+        self.kind = kind
+        self.args = args
+
+    def text(self):
+        return ("%s %s" % (self.kind, self.args)).rstrip()
+
+    def __str__(self):
+        return "line %d: %.3f %s" % (self.line_number, self.ms, self.text())
+
+
+def channel_of(kind, args):
+    pin = args.split(" ", 1)[0]
+    if kind in PIN_KINDS:
+        return "%s %s" % (kind, pin)
+    if kind in ("tone", "notone"):
+        return "tone %s" % pin
+    return kind
+
+
+def text_bytes(args):
+    """Bytes of a text tx line ("...", with \\r and \\n escaped)."""
+    return list(args[1:-1].replace("\\r", "\r").replace("\\n", "\n").encode("latin-1"))
+
+
+class TxFramer:
+    """Join hex tx lines into a byte stream and cut it into command frames."""
+
+    def __init__(self):
+        self.pending = []  # (byte, line number, ms)
+
+    def feed(self, number, ms, args):
+        """Return [(line number, ms, args)] completed by this tx line."""
+        if args.startswith('"'):
+            if not self.pending:
+                return [(number, ms, args)]
+            # 프레임 중간에 글자처럼 보이는 바이트만 온 경우
+            data = text_bytes(args)
+        else:
+            data = [int(value, 16) for value in args.split()]
+        self.pending.extend((value, number, ms) for value in data)
+
+        outputs = []
+        while self.pending:
+            if self.pending[0][0] != FRAME_SYNC:
+                outputs.append(self.take(1))
+                continue
+            if len(self.pending) < 4 or len(self.pending) < 4 + self.pending[1][0]:
+                break
+            outputs.append(self.take(4 + self.pending[1][0]))
+        return outputs
+
+    def take(self, count):
+        chunk, self.pending = self.pending[:count], self.pending[count:]
+        return chunk[0][1], chunk[0][2], " ".join("%02x" % value for value, _, _ in chunk)
+
+    def flush(self):
+        return [self.take(len(self.pending))] if self.pending else []
+
+
+def load(path, kinds, ignore, masks):
+    """Return {channel: [Output]} in file order."""
+    channels = OrderedDict()
+    framer = TxFramer()
+
+    def add(number, ms, kind, args):
+        for mask in masks:
+            args = mask.sub("*", args)
+        if (kinds and kind not in kinds) or kind in ignore:
+            return
+        channels.setdefault(channel_of(kind, args), []).append(Output(number, ms, kind, args))
+
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.rstrip("\n")
+            if not line or line.startswith("#"):
+                continue
+            fields = line.split(" ", 2)
+            if len(fields) < 2:
+                sys.exit("%s:%d: malformed line: %s" % (path, number, line))
+            kind = fields[1]
+            args = fields[2] if len(fields) > 2 else ""
+            try:
+                ms = float(fields[0])
+            except ValueError:
+                sys.exit("%s:%d: bad timestamp: %s" % (path, number, fields[0]))
+            if kind == "tx":
+                for output in framer.feed(number, ms, args):
+                    add(output[0], output[1], kind, output[2])
+            else:
+                add(number, ms, kind, args)
+    for output in framer.flush():
+        add(output[0], output[1], "tx", output[2])
+    return channels
+
+
+def compare_channel(name, golden, actual, tolerance, report):
+    """Report differences of one channel, return (mismatches, worst drift ms)."""
+    mismatches = 0
+    drift = 0.0
+    for i in range(max(len(golden), len(actual))):
+        want = golden[i] if i < len(golden) else None
+        got = actual[i] if i < len(actual) else None
+        if want is None:
+            report("%s: unexpected %s" % (name, got))
+        elif got is None:
+            report("%s: missing %s" % (name, want))
+        elif want.text() != got.text():
+            report("%s: expected %s\n%s  got      %s" % (name, want, " " * len(name), got))
+        else:
+            delta = abs(got.ms - want.ms)
+            drift = max(drift, delta)
+            if delta <= tolerance:
+                continue
+            report("%s: moved %+.3f ms, expected %s\n%s  got      %s"
+                   % (name, got.ms - want.ms, want, " " * len(name), got))
+        mismatches += 1
+        # 순서가 어긋나면 뒤는 모두 달라지므로 채널당 첫 차이만 자세히
+        if want is None or got is None or want.text() != got.text():
+            remaining = max(len(golden), len(actual)) - i - 1
+            if remaining:
+                report("%s: (%d more outputs not compared)" % (" " * len(name), remaining))
+            break
+    return mismatches, drift
+
+
+def split_list(text):
+    return set(item for item in text.split(",") if item) if text else set()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("golden", help="expected trace")
+    parser.add_argument("actual", help="new trace")
+    parser.add_argument("--tolerance", type=float, default=5.0,
+                        help="allowed timing difference per output in ms (default 5)")
+    parser.add_argument("--kinds", default="",
+                        help="compare only these kinds, e.g. servo,tone,notone,lcd,led")
+    parser.add_argument("--ignore", default="", help="kinds to skip, e.g. tx,eeprom")
+    parser.add_argument("--mask", action="append", default=[], metavar="REGEX",
+                        help="replace matches with * before comparing (repeatable)")
+    parser.add_argument("-q", "--quiet", action="store_true", help="only set the exit status")
+    parser.add_argument("-v", "--verbose", action="store_true", help="print drift per channel")
+    args = parser.parse_args()
+
+    kinds = split_list(args.kinds)
+    ignore = split_list(args.ignore)
+    masks = [re.compile(mask) for mask in args.mask]
+    golden = load(args.golden, kinds, ignore, masks)
+    actual = load(args.actual, kinds, ignore, masks)
+
+    def report(message):
+        if not args.quiet:
+            print(message)
+
+    total = 0
+    for name in list(golden) + [c for c in actual if c not in golden]:
+        mismatches, drift = compare_channel(name, golden.get(name, []), actual.get(name, []),
+                                            args.tolerance, report)
+        total += mismatches
+        if args.verbose:
+            print("%-10s %5d outputs, max drift %.3f ms" % (name, len(golden.get(name, [])), drift))
+
+    if total:
+        report("%s: %d difference(s)" % (args.actual, total))
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()